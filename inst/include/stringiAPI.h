@@ -0,0 +1,269 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef STRINGI_API_H
+#define STRINGI_API_H
+
+/*
+A C API to some of stringi's internals, for use by other packages
+in tight loops (without the overhead of .Call and argument preparation).
+
+Usage: add `LinkingTo: stringi` and `Imports: stringi` to your DESCRIPTION
+file and `#include <stringiAPI.h>` in your C or C++ sources. The function
+pointers are retrieved via R_GetCCallable on first use (separately in each
+translation unit), so the first call must be made from R's main thread;
+call stringi_capi_require(STRINGI_CAPI_VERSION) before using the API
+in other threads.
+
+Versioning: STRINGI_CAPI_VERSION is increased whenever new functions are
+added; the existing ones are never changed nor removed. Check the version
+provided by the installed stringi with stringi_capi_require().
+
+Strings are given as (pointer, number of bytes) pairs, need not be
+NUL-terminated, and must be in UTF-8 (unless stated otherwise, invalid
+UTF-8 is not permitted). Byte offsets and lengths are ints, as in R.
+
+Threads: all functions other than stringi_capi_* and
+stringi_collator_new may be called from any thread, provided that
+a single matcher is not used by two threads at the same time
+(collators can be shared). They never call the R API nor longjmp;
+errors are reported via return values.
+*/
+
+#include <R.h>
+#include <Rinternals.h>
+#include <R_ext/Rdynload.h>
+
+#define STRINGI_CAPI_VERSION 1
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+typedef struct stric_matcher stric_matcher;    /* opaque */
+typedef struct stric_collator stric_collator;  /* opaque */
+
+
+/* Pointers to the functions in stringi's shared library,
+   see stringi_capi_init */
+typedef struct stringi_capi_t {
+    int loaded;
+    int (*capi_version)(void);
+    int (*utf8_invalid_offset)(const char*, int);
+    int (*utf8_length)(const char*, int);
+    int (*utf8_width)(const char*, int);
+    int (*utf8_nfc)(const char*, int, char*, int);
+    stric_matcher* (*matcher_new)(const char*, int, int, int);
+    void (*matcher_free)(stric_matcher*);
+    void (*matcher_reset)(stric_matcher*, const char*, int);
+    int (*matcher_find_next)(stric_matcher*, int*);
+    int (*matcher_find_last)(stric_matcher*, int*);
+    stric_collator* (*collator_new)(SEXP);
+    void (*collator_free)(stric_collator*);
+    int (*collator_compare)(const stric_collator*, const char*, int, const char*, int);
+    int (*collator_sort_key)(const stric_collator*, const char*, int, unsigned char*, int);
+} stringi_capi_t;
+
+static stringi_capi_t stringi__capi;  /* zero-initialised */
+
+
+/* Retrieve all the function pointers (once); must be called from
+   R's main thread before any of the functions is used in other threads */
+static inline void stringi_capi_init(void)
+{
+    if (stringi__capi.loaded) return;
+    /* version 1 */
+    stringi__capi.capi_version = (int (*)(void)) (void (*)(void)) R_GetCCallable("stringi", "stric_capi_version");
+    stringi__capi.utf8_invalid_offset = (int (*)(const char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_utf8_invalid_offset");
+    stringi__capi.utf8_length = (int (*)(const char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_utf8_length");
+    stringi__capi.utf8_width = (int (*)(const char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_utf8_width");
+    stringi__capi.utf8_nfc = (int (*)(const char*, int, char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_utf8_nfc");
+    stringi__capi.matcher_new = (stric_matcher* (*)(const char*, int, int, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_matcher_new");
+    stringi__capi.matcher_free = (void (*)(stric_matcher*)) (void (*)(void)) R_GetCCallable("stringi", "stric_matcher_free");
+    stringi__capi.matcher_reset = (void (*)(stric_matcher*, const char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_matcher_reset");
+    stringi__capi.matcher_find_next = (int (*)(stric_matcher*, int*)) (void (*)(void)) R_GetCCallable("stringi", "stric_matcher_find_next");
+    stringi__capi.matcher_find_last = (int (*)(stric_matcher*, int*)) (void (*)(void)) R_GetCCallable("stringi", "stric_matcher_find_last");
+    stringi__capi.collator_new = (stric_collator* (*)(SEXP)) (void (*)(void)) R_GetCCallable("stringi", "stric_collator_new");
+    stringi__capi.collator_free = (void (*)(stric_collator*)) (void (*)(void)) R_GetCCallable("stringi", "stric_collator_free");
+    stringi__capi.collator_compare = (int (*)(const stric_collator*, const char*, int, const char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_collator_compare");
+    stringi__capi.collator_sort_key = (int (*)(const stric_collator*, const char*, int, unsigned char*, int)) (void (*)(void)) R_GetCCallable("stringi", "stric_collator_sort_key");
+    /* functions added in later versions should only be fetched
+       if stringi__capi.capi_version() is large enough */
+    stringi__capi.loaded = 1;
+}
+
+
+/* Version of the C API provided by the installed stringi */
+static inline int stringi_capi_version(void)
+{
+    stringi_capi_init();
+    return stringi__capi.capi_version();
+}
+
+
+/* Calls stringi_capi_init and Rf_error if the installed stringi
+   does not provide the given version of the C API */
+static inline void stringi_capi_require(int version)
+{
+    int have = stringi_capi_version();
+    if (have < version)
+        Rf_error("stringi C API version %d required, but %d found; "
+            "please update stringi", version, have);
+}
+
+
+/* Available since version 1 */
+
+/* -1 if valid UTF-8, otherwise the offset of the first ill-formed sequence */
+static inline int stringi_utf8_invalid_offset(const char* s, int n)
+{
+    stringi_capi_init();
+    return stringi__capi.utf8_invalid_offset(s, n);
+}
+
+
+/* Number of code points or -1 on invalid UTF-8 */
+static inline int stringi_utf8_length(const char* s, int n)
+{
+    stringi_capi_init();
+    return stringi__capi.utf8_length(s, n);
+}
+
+
+/* Width (as in stri_width) or -1 on invalid UTF-8 */
+static inline int stringi_utf8_width(const char* s, int n)
+{
+    stringi_capi_init();
+    return stringi__capi.utf8_width(s, n);
+}
+
+
+/* NFC normalisation: writes the result to buf (not NUL-terminated)
+   and returns its length in bytes or -1 on error; if the length
+   exceeds buf_size, buf is unspecified and the call should be repeated
+   with a larger buffer */
+static inline int stringi_utf8_nfc(const char* s, int n, char* buf,
+    int buf_size)
+{
+    stringi_capi_init();
+    return stringi__capi.utf8_nfc(s, n, buf, buf_size);
+}
+
+
+/* Fixed pattern (byte) search, see stri_opts_fixed.
+   The pattern (non-empty) is copied. Returns NULL on error. */
+static inline stric_matcher* stringi_matcher_new(const char* pattern,
+    int pattern_len, int case_insensitive, int overlap)
+{
+    stringi_capi_init();
+    return stringi__capi.matcher_new(pattern, pattern_len, case_insensitive, overlap);
+}
+
+
+static inline void stringi_matcher_free(stric_matcher* matcher)
+{
+    stringi_capi_init();
+    stringi__capi.matcher_free(matcher);
+}
+
+
+/* Set the string to search in (not copied, must outlive the search) */
+static inline void stringi_matcher_reset(stric_matcher* matcher,
+    const char* s, int n)
+{
+    stringi_capi_init();
+    stringi__capi.matcher_reset(matcher, s, n);
+}
+
+
+/* Byte offset of the next match (or -1 if there are no more),
+   its length is stored in *match_len (unless NULL) */
+static inline int stringi_matcher_find_next(stric_matcher* matcher,
+    int* match_len)
+{
+    stringi_capi_init();
+    return stringi__capi.matcher_find_next(matcher, match_len);
+}
+
+
+/* Byte offset of the last match (or -1), see stringi_matcher_find_next */
+static inline int stringi_matcher_find_last(stric_matcher* matcher,
+    int* match_len)
+{
+    stringi_capi_init();
+    return stringi__capi.matcher_find_last(matcher, match_len);
+}
+
+
+/* Collator with the settings as in stri_opts_collator (an R list or NULL);
+   main thread only, may call Rf_error */
+static inline stric_collator* stringi_collator_new(SEXP opts_collator)
+{
+    stringi_capi_init();
+    return stringi__capi.collator_new(opts_collator);
+}
+
+
+static inline void stringi_collator_free(stric_collator* collator)
+{
+    stringi_capi_init();
+    stringi__capi.collator_free(collator);
+}
+
+
+/* -1, 0, or 1 (less, equal, greater), -2 on error */
+static inline int stringi_collator_compare(const stric_collator* collator,
+    const char* s1, int n1, const char* s2, int n2)
+{
+    stringi_capi_init();
+    return stringi__capi.collator_compare(collator, s1, n1, s2, n2);
+}
+
+
+/* Sort key (as in stri_sort_key, NUL-terminated) written to buf;
+   returns its size (including the NUL) or -1 on error; if the size
+   exceeds buf_size, buf is unspecified and the call should be repeated
+   with a larger buffer */
+static inline int stringi_collator_sort_key(const stric_collator* collator,
+    const char* s, int n, unsigned char* buf, int buf_size)
+{
+    stringi_capi_init();
+    return stringi__capi.collator_sort_key(collator, s, n, buf, buf_size);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
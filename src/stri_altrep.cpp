@@ -0,0 +1,222 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_altrep.h"
+
+#if R_VERSION >= R_Version(3, 6, 0)
+#define STRI_ALTREP_SUBSTRINGS 1
+#include <R_ext/Altrep.h>
+#else
+#define STRI_ALTREP_SUBSTRINGS 0
+#endif
+
+
+#if STRI_ALTREP_SUBSTRINGS
+
+/* The `stri_substrings` ALTSTRING class
+ *
+ * data1: list(src, pos) -- src is a STRSXP with the source CHARSXPs
+ *        and pos gives (byte offset, byte length) for each element;
+ *        R_NilValue once all the elements have been materialised
+ *        (the source strings are no longer needed then)
+ * data2: STRSXP cache of the materialised elements (R_BlankString
+ *        denotes "not yet computed") or R_NilValue if not yet allocated
+ */
+static R_altrep_class_t stri__altrep_substrings_class;
+static bool stri__altrep_substrings_registered = false;
+
+
+static inline bool stri__altrep_substrings_is_materialised(SEXP x)
+{
+    return R_altrep_data1(x) == R_NilValue;
+}
+
+
+static R_xlen_t stri__altrep_substrings_Length(SEXP x)
+{
+    if (stri__altrep_substrings_is_materialised(x))
+        return XLENGTH(R_altrep_data2(x));
+    else
+        return XLENGTH(VECTOR_ELT(R_altrep_data1(x), 0));
+}
+
+
+static SEXP stri__altrep_substrings_get_cache(SEXP x)
+{
+    SEXP cache = R_altrep_data2(x);
+    if (cache == R_NilValue) {
+        // filled with R_BlankString
+        cache = Rf_allocVector(STRSXP, stri__altrep_substrings_Length(x));
+        R_set_altrep_data2(x, cache);
+    }
+    return cache;
+}
+
+
+static SEXP stri__altrep_substrings_Elt(SEXP x, R_xlen_t i)
+{
+    if (stri__altrep_substrings_is_materialised(x))
+        return STRING_ELT(R_altrep_data2(x), i);
+
+    SEXP data1 = R_altrep_data1(x);
+    SEXP src = STRING_ELT(VECTOR_ELT(data1, 0), i);
+    if (src == NA_STRING)
+        return NA_STRING;
+
+    const int* pos = INTEGER(VECTOR_ELT(data1, 1));
+    if (pos[2*i+1] <= 0)
+        return R_BlankString;
+
+    SEXP cache = stri__altrep_substrings_get_cache(x);  // referenced by x
+    SEXP val = STRING_ELT(cache, i);
+    if (val == R_BlankString) {
+        val = Rf_mkCharLenCE(CHAR(src)+pos[2*i], pos[2*i+1], CE_UTF8);
+        SET_STRING_ELT(cache, i, val);
+    }
+    return val;
+}
+
+
+static void stri__altrep_substrings_materialise(SEXP x)
+{
+    if (stri__altrep_substrings_is_materialised(x))
+        return;
+
+    R_xlen_t n = stri__altrep_substrings_Length(x);
+    SEXP cache = stri__altrep_substrings_get_cache(x);
+    SEXP srcs = VECTOR_ELT(R_altrep_data1(x), 0);
+    for (R_xlen_t i=0; i<n; ++i) {
+        if (STRING_ELT(srcs, i) == NA_STRING)
+            SET_STRING_ELT(cache, i, NA_STRING);
+        else
+            stri__altrep_substrings_Elt(x, i);  // stores the element in the cache
+    }
+
+    R_set_altrep_data1(x, R_NilValue);  // release the source strings
+}
+
+
+static void* stri__altrep_substrings_Dataptr(SEXP x, Rboolean /*writeable*/)
+{
+    stri__altrep_substrings_materialise(x);
+    return (void*)STRING_PTR_RO(R_altrep_data2(x));
+}
+
+
+static const void* stri__altrep_substrings_Dataptr_or_null(SEXP x)
+{
+    if (stri__altrep_substrings_is_materialised(x))
+        return (const void*)STRING_PTR_RO(R_altrep_data2(x));
+    else
+        return NULL;
+}
+
+
+static void stri__altrep_substrings_Set_elt(SEXP x, R_xlen_t i, SEXP v)
+{
+    stri__altrep_substrings_materialise(x);
+    SET_STRING_ELT(R_altrep_data2(x), i, v);
+}
+
+
+static SEXP stri__altrep_substrings_Duplicate(SEXP x, Rboolean /*deep*/)
+{
+    stri__altrep_substrings_materialise(x);
+    return Rf_duplicate(R_altrep_data2(x));
+}
+
+
+static Rboolean stri__altrep_substrings_Inspect(SEXP x, int /*pre*/, int /*deep*/,
+    int /*pvec*/, void (* /*inspect_subtree*/)(SEXP, int, int, int))
+{
+    Rprintf(" stri_substrings (len=%lld, %s)\n",
+        (long long)stri__altrep_substrings_Length(x),
+        stri__altrep_substrings_is_materialised(x)?"materialised":"lazy");
+    return TRUE;
+}
+
+#endif
+
+
+/** Registers the ALTREP classes; called by R_init_stringi
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void stri__altrep_init(DllInfo* dll)
+{
+#if STRI_ALTREP_SUBSTRINGS
+    R_altrep_class_t cls = R_make_altstring_class("stri_substrings", "stringi", dll);
+
+    R_set_altrep_Length_method(cls, stri__altrep_substrings_Length);
+    R_set_altrep_Inspect_method(cls, stri__altrep_substrings_Inspect);
+    R_set_altrep_Duplicate_method(cls, stri__altrep_substrings_Duplicate);
+    R_set_altvec_Dataptr_method(cls, stri__altrep_substrings_Dataptr);
+    R_set_altvec_Dataptr_or_null_method(cls, stri__altrep_substrings_Dataptr_or_null);
+    R_set_altstring_Elt_method(cls, stri__altrep_substrings_Elt);
+    R_set_altstring_Set_elt_method(cls, stri__altrep_substrings_Set_elt);
+
+    stri__altrep_substrings_class = cls;
+    stri__altrep_substrings_registered = true;
+#else
+    (void)dll;
+#endif
+}
+
+
+/** Can lazy substring vectors be created?
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool stri__altrep_lazy_substrings_available()
+{
+#if STRI_ALTREP_SUBSTRINGS
+    return stri__altrep_substrings_registered;
+#else
+    return false;
+#endif
+}
+
+
+/** Get the result vector
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP StriSubstrings::toR() const
+{
+#if STRI_ALTREP_SUBSTRINGS
+    if (m_lazy)
+        return R_new_altrep(stri__altrep_substrings_class, m_data, R_NilValue);
+#endif
+    return m_data;
+}
@@ -0,0 +1,162 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef __stri_altrep_h
+#define __stri_altrep_h
+
+#include "stri_stringi.h"
+
+
+/// lazy vectors are not worth the overhead for shorter results
+#define STRI__LAZY_SUBSTRINGS_MIN_LENGTH 32
+
+
+void stri__altrep_init(DllInfo* dll);
+bool stri__altrep_lazy_substrings_available();
+
+
+/**
+ * A character vector of substrings of existing strings
+ *
+ * In the eager mode, this is an ordinary character vector, and each
+ * substring is copied to a new CHARSXP immediately.
+ *
+ * In the lazy mode (see \code{stri_options(lazy_substrings=TRUE)}),
+ * we only store (source CHARSXP, byte offset, byte length) triples;
+ * the CHARSXPs are created on demand by an ALTREP class, see stri_altrep.cpp.
+ * Source strings must be in UTF-8 (or ASCII) and the byte ranges must
+ * be well-formed, which is the case if the source strings
+ * are read-only views in a \code{StriContainerUTF8}
+ * (see \code{StriContainerUTF8::isReadOnly}).
+ *
+ * Usage:
+ * \code{StriSubstrings ans(n, lazy); STRI__PROTECT(ans.getData());}
+ * then \code{set()} or \code{setNA()} each element, and finally call
+ * \code{toR()}.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriSubstrings {
+
+private:
+
+    R_xlen_t m_n;
+    bool m_lazy;
+    SEXP m_data;   ///< STRSXP (eager) or VECSXP with a STRSXP and an INTSXP (lazy)
+    SEXP m_src;    ///< source CHARSXPs (lazy)
+    int* m_pos;    ///< 2*n ints: byte offsets and lengths (lazy)
+
+
+public:
+
+    /** Whether to use the lazy mode for a result vector of length \code{n}
+     *  referring to the strings in a container which are all read-only
+     */
+    static bool useLazy(R_xlen_t n, bool all_read_only)
+    {
+        return all_read_only && n >= STRI__LAZY_SUBSTRINGS_MIN_LENGTH
+            && stri__getopt_lazy_substrings()
+            && stri__altrep_lazy_substrings_available();
+    }
+
+
+    /** allocates the result vector; the caller must PROTECT getData() */
+    StriSubstrings(R_xlen_t n, bool lazy)
+    {
+        m_n = n;
+        m_lazy = lazy;
+        if (m_lazy) {
+            PROTECT(m_data = Rf_allocVector(VECSXP, 2));
+            m_src = Rf_allocVector(STRSXP, n);
+            SET_VECTOR_ELT(m_data, 0, m_src);
+            SEXP pos = Rf_allocVector(INTSXP, 2*n);
+            SET_VECTOR_ELT(m_data, 1, pos);
+            m_pos = INTEGER(pos);
+            UNPROTECT(1);
+        }
+        else {
+            m_data = Rf_allocVector(STRSXP, n);
+            m_src = R_NilValue;
+            m_pos = NULL;
+        }
+    }
+
+
+    inline SEXP getData() const
+    {
+        return m_data;
+    }
+
+
+    /** set the i-th element to a missing value */
+    inline void setNA(R_xlen_t i)
+    {
+        if (m_lazy) {
+            SET_STRING_ELT(m_src, i, NA_STRING);
+            m_pos[2*i] = 0;
+            m_pos[2*i+1] = 0;
+        }
+        else
+            SET_STRING_ELT(m_data, i, NA_STRING);
+    }
+
+
+    /** set the i-th element
+     *
+     * @param i index
+     * @param src source CHARSXP, i.e., the one \code{s} points to
+     *     (used in the lazy mode only; may be NULL in the eager one)
+     * @param s pointer to the substring
+     * @param n substring length in bytes
+     */
+    inline void set(R_xlen_t i, SEXP src, const char* s, R_len_t n)
+    {
+        if (m_lazy) {
+            SET_STRING_ELT(m_src, i, src);
+            m_pos[2*i] = (int)(s-CHAR(src));
+            m_pos[2*i+1] = n;
+        }
+        else
+            SET_STRING_ELT(m_data, i, Rf_mkCharLenCE(s, n, CE_UTF8));
+    }
+
+
+    /** get the result; STRSXP (eager) or an ALTREP STRSXP (lazy)
+     *
+     *  the returned object is not PROTECTed
+     */
+    SEXP toR() const;
+};
+
+
+#endif
@@ -31,6 +31,105 @@
 
 #include "stri_stringi.h"
 #include "stri_brkiter.h"
+#include "stri_icu_cache.h"
+#include <unicode/rbbi.h>
+#include <string>
+
+
+/* max number of break iterator prototypes kept in the cache */
+#define STRI__BRKITER_CACHE_MAX_SIZE 64
+
+
+static StriICUCache<BreakIterator> stri__brkiter_cache_obj(STRI__BRKITER_CACHE_MAX_SIZE);
+
+
+/** Break iterators (without text), keyed by type, locale, and rules
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriICUCache<BreakIterator>& stri__brkiter_cache()
+{
+    return stri__brkiter_cache_obj;
+}
+
+
+/** Create a break iterator
+ *
+ * Loading the locale data and compiling the rules is expensive,
+ * hence the iterators are cloned from cached prototypes if possible.
+ * The skip rule status options are not a part of the key
+ * as they are only applied to the boundaries found.
+ *
+ * @param type break iterator type (ignored if rules are given)
+ * @param locale locale ID or NULL for the default locale
+ *     (ignored if rules are given)
+ * @param rules custom rules or an empty string
+ * @return a new object, owned by the caller
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     separated from StriUBreakIterator::open()
+ *     and StriRuleBasedBreakIterator::open(), cache
+ */
+BreakIterator* stri__brkiter_create(UBreakIteratorType type,
+    const char* locale, const UnicodeString& rules)
+{
+    std::string key;
+    if (!rules.isEmpty()) {
+        key = "R:";
+        rules.toUTF8String(key);
+    }
+    else {
+        key = (char)('0'+(int)type);
+        key += (locale)?":":"?";  // NULL != ""
+        if (locale) key += locale;
+    }
+
+    BreakIterator* briter = stri__brkiter_cache().get(key);
+    if (briter) return briter;
+
+    UErrorCode status = U_ZERO_ERROR;
+    if (!rules.isEmpty()) {
+        UParseError parseErr;
+        briter = (BreakIterator*) new RuleBasedBreakIterator(
+                     UnicodeString(rules), parseErr, status
+                 );
+    }
+    else {
+        Locale loc = Locale::createFromName(locale);
+        switch (type) {
+        case UBRK_CHARACTER: // character
+            briter = BreakIterator::createCharacterInstance(loc, status);
+            break;
+        case UBRK_LINE: // line_break
+            briter = BreakIterator::createLineInstance(loc, status);
+            break;
+        case UBRK_SENTENCE: // sentence
+            briter = BreakIterator::createSentenceInstance(loc, status);
+            break;
+        case UBRK_WORD: // word
+            briter = BreakIterator::createWordInstance(loc, status);
+            break;
+        default:
+            throw StriException(MSG__INTERNAL_ERROR);
+        }
+    }
+    STRI__CHECKICUSTATUS_THROW(status, {
+        if (briter) delete briter;
+    })
+
+    if (status == U_USING_DEFAULT_WARNING && briter && locale) {
+        UErrorCode status2 = U_ZERO_ERROR;
+        const char* valid_locale = briter->getLocaleID(ULOC_VALID_LOCALE, status2);
+        if (valid_locale && !strcmp(valid_locale, "root")) {
+            // not cached, so that we warn each time
+            Rf_warning("%s", ICUError::getICUerrorName(status));
+            return briter;
+        }
+    }
+
+    stri__brkiter_cache().put(key, briter);
+    return briter;
+}
 
 
 /** Select Break Iterator
@@ -259,6 +358,10 @@ void StriBrkIterOptions::setSkipRuleStatus(SEXP opts_brkiter) {
 /**
  *
  * @ version 0.4-1 (Marek Gagolewski, 2014-12-03)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII strings: precompute all the boundaries with
+ *    stri__brkiter_ascii_boundaries if the rules allow it
  */
 void StriRuleBasedBreakIterator::setupMatcher(const char* _searchStr, R_len_t _searchLen)
 {
@@ -268,6 +371,11 @@ void StriRuleBasedBreakIterator::setupMatcher(const char* _searchStr, R_len_t _s
     this->searchLen = _searchLen;
     this->searchPos = BreakIterator::DONE;
 
+    this->asciiIdx = 0;
+    this->asciiUsed = this->asciiSupported && stri__brkiter_ascii_boundaries(
+        type, _searchStr, _searchLen, this->asciiBdr, this->asciiStatus);
+    if (this->asciiUsed) return;
+
     UErrorCode status = U_ZERO_ERROR;
     this->searchText = utext_openUTF8(this->searchText,
                                       _searchStr, _searchLen, &status);
@@ -292,13 +400,13 @@ void StriRuleBasedBreakIterator::setupMatcher(const char* _searchStr, R_len_t _s
  */
 bool StriRuleBasedBreakIterator::ignoreBoundary() {
 #ifndef NDEBUG
-    if (!rbiterator || !searchText)
+    if (!rbiterator || (!searchText && !asciiUsed))
         throw StriException("!NDEBUG: StriRuleBasedBreakIterator::ignoreBoundary()");
 #endif
 
     if (skip_size <= 0) return false;
 
-    int rule = rbiterator->getRuleStatus();   /* this is ICU 52 */
+    int rule = (asciiUsed)?asciiStatus[asciiIdx]:rbiterator->getRuleStatus();   /* this is ICU 52 */
     for (int i=0; i<skip_size; i += 2) {
         // skip_size is even - that's sure
         if (rule >= skip_rules[i] && rule < skip_rules[i+1])
@@ -320,7 +428,12 @@ void StriRuleBasedBreakIterator::first()
         throw StriException("!NDEBUG: StriRuleBasedBreakIterator::first");
 #endif
 
-    this->searchPos = rbiterator->first(); // ICU man: "The offset of the beginning of the text, zero."
+    if (asciiUsed) {
+        asciiIdx = 0;
+        this->searchPos = asciiBdr[0];
+    }
+    else
+        this->searchPos = rbiterator->first(); // ICU man: "The offset of the beginning of the text, zero."
 
 #ifndef NDBEGUG
     if (this->searchPos != 0)
@@ -335,7 +448,7 @@ void StriRuleBasedBreakIterator::first()
  */
 bool StriRuleBasedBreakIterator::next()
 {
-    while ((this->searchPos = rbiterator->next()) != BreakIterator::DONE) {
+    while ((this->searchPos = moveNext()) != BreakIterator::DONE) {
         if (!ignoreBoundary())
             return true;
     }
@@ -350,7 +463,7 @@ bool StriRuleBasedBreakIterator::next()
 bool StriRuleBasedBreakIterator::next(std::pair<R_len_t, R_len_t>& bdr)
 {
     R_len_t lastPos = searchPos;
-    while ((searchPos = rbiterator->next()) != BreakIterator::DONE) {
+    while ((searchPos = moveNext()) != BreakIterator::DONE) {
         if (!ignoreBoundary()) {
             bdr.first  = lastPos;
             bdr.second = searchPos;
@@ -376,8 +489,14 @@ void StriRuleBasedBreakIterator::last()
         throw StriException("!NDEBUG: StriRuleBasedBreakIterator::last");
 #endif
 
-    rbiterator->first();
-    this->searchPos = rbiterator->last(); // ICU man: "The text's past-the-end offset. "
+    if (asciiUsed) {
+        asciiIdx = (R_len_t)asciiBdr.size()-1;
+        this->searchPos = asciiBdr[asciiIdx];
+    }
+    else {
+        rbiterator->first();
+        this->searchPos = rbiterator->last(); // ICU man: "The text's past-the-end offset. "
+    }
 
 #ifndef NDBEGUG
     if (this->searchPos > this->searchLen)
@@ -395,12 +514,12 @@ bool StriRuleBasedBreakIterator::previous(std::pair<R_len_t, R_len_t>& bdr)
     do {
         if (!ignoreBoundary()) {
             bdr.second  = searchPos;
-            searchPos = rbiterator->previous();
+            searchPos = movePrevious();
             if (searchPos == BreakIterator::DONE) return false;
             bdr.first = searchPos;
             return true;
         }
-        searchPos = rbiterator->previous();
+        searchPos = movePrevious();
     }
     while (searchPos != BreakIterator::DONE);
     return false;
@@ -41,6 +41,18 @@
 #include <unicode/uloc.h>
 #include <unicode/locid.h>
 
+
+BreakIterator* stri__brkiter_create(UBreakIteratorType type,
+    const char* locale, const UnicodeString& rules);
+
+bool stri__brkiter_ascii_supported(UBreakIteratorType type,
+    const BreakIterator* briter);
+
+bool stri__brkiter_ascii_boundaries(UBreakIteratorType type,
+    const char* str, R_len_t n,
+    std::vector<R_len_t>& bdr, std::vector<int32_t>& status);
+
+
 /**
  * A class to manage a break iterator's options
  *
@@ -104,6 +116,9 @@ public:
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-09)
  *     warn if resource bundle for an explicitly set locale is unavailable
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     use stri__brkiter_create (cached prototypes)
  */
 class StriUBreakIterator : public StriBrkIterOptions {
 private:
@@ -114,39 +129,9 @@ private:
 #ifndef NDEBUG
         if (uiterator) throw StriException("!NDEBUG: StriUBreakIterator::open()");
 #endif
-        UErrorCode status = U_ZERO_ERROR;
-        if (!rules.isEmpty()) {
-            UParseError parseErr;
-            uiterator = ubrk_openRules(rules.getTerminatedBuffer(),
-                                       -1/*null-terminated*/, NULL, 0,
-                                       &parseErr, &status);
-        }
-        else {
-            switch (type) {
-            case UBRK_CHARACTER: // character
-                uiterator = ubrk_open(UBRK_CHARACTER, locale, NULL, 0, &status);
-                break;
-            case UBRK_LINE: // line_break
-                uiterator = ubrk_open(UBRK_LINE, locale, NULL, 0, &status);
-                break;
-            case UBRK_SENTENCE: // sentence
-                uiterator = ubrk_open(UBRK_SENTENCE, locale, NULL, 0, &status);
-                break;
-            case UBRK_WORD: // word
-                uiterator = ubrk_open(UBRK_WORD, locale, NULL, 0, &status);
-                break;
-            default:
-                throw StriException(MSG__INTERNAL_ERROR);
-            }
-        }
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-        if (status == U_USING_DEFAULT_WARNING && uiterator && locale) {
-            UErrorCode status2 = U_ZERO_ERROR;
-            const char* valid_locale = ubrk_getLocaleByType(uiterator, ULOC_VALID_LOCALE, &status2);
-            if (valid_locale && !strcmp(valid_locale, "root"))
-                Rf_warning("%s", ICUError::getICUerrorName(status));
-        }
+        // a UBreakIterator is a BreakIterator in disguise (cf. ubrk_open)
+        uiterator = reinterpret_cast<UBreakIterator*>(
+            stri__brkiter_create(type, locale, rules));
     }
 
 
@@ -208,6 +193,10 @@ public:
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-09)
  *     warn if resource bundle for an explicitly set locale is unavailable
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     use stri__brkiter_create (cached prototypes);
+ *     ASCII strings are processed by a specialised engine if possible
  */
 class StriRuleBasedBreakIterator : public StriBrkIterOptions {
 private:
@@ -218,54 +207,55 @@ private:
     const char* searchStr; // owned by caller
     R_len_t searchLen; // in bytes
 
+    bool asciiSupported; // can stri__brkiter_ascii_boundaries be used?
+    bool asciiUsed;      // is it used for the current string?
+    std::vector<R_len_t> asciiBdr;    // boundaries found by the ASCII engine
+    std::vector<int32_t> asciiStatus; // and the corresponding rule statuses
+    R_len_t asciiIdx;    // current index in asciiBdr
+
     void setEmptyOpts() {
         rbiterator = NULL;
         searchText = NULL;
         searchPos = BreakIterator::DONE;
         searchStr = NULL;
         searchLen = 0;
+        asciiSupported = false;
+        asciiUsed = false;
+        asciiIdx = 0;
     }
 
     void open() {
-        UErrorCode status = U_ZERO_ERROR;
-        Locale loc = Locale::createFromName(locale);
-        if (!rules.isEmpty()) {
-            UParseError parseErr;
-            rbiterator = (BreakIterator*) new RuleBasedBreakIterator(
-                             UnicodeString(rules), parseErr, status
-                         );
-        }
-        else {
-            switch (type) {
-            case UBRK_CHARACTER: // character
-                rbiterator = (BreakIterator*)BreakIterator::createCharacterInstance(loc, status);
-                break;
-            case UBRK_LINE: // line_break
-                rbiterator = (BreakIterator*)BreakIterator::createLineInstance(loc, status);
-                break;
-            case UBRK_SENTENCE: // sentence
-                rbiterator = (BreakIterator*)BreakIterator::createSentenceInstance(loc, status);
-                break;
-            case UBRK_WORD: // word
-                rbiterator = (BreakIterator*)BreakIterator::createWordInstance(loc, status);
-                break;
-            default:
-                throw StriException(MSG__INTERNAL_ERROR);
-            }
+        rbiterator = stri__brkiter_create(type, locale, rules);
+        asciiSupported = rules.isEmpty() &&
+            stri__brkiter_ascii_supported(type, rbiterator);
+    }
 
+    void close() {
+        if (rbiterator) {
+            delete rbiterator;
+            rbiterator = NULL;
         }
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
-        if (status == U_USING_DEFAULT_WARNING && rbiterator && locale) {
-            UErrorCode status2 = U_ZERO_ERROR;
-            const char* valid_locale = rbiterator->getLocaleID(ULOC_VALID_LOCALE, status2);
-            if (valid_locale && !strcmp(valid_locale, "root"))
-                Rf_warning("%s", ICUError::getICUerrorName(status));
+        if (searchText) {
+            utext_close(searchText);
+            searchText = NULL;
         }
     }
 
     bool ignoreBoundary();
 
+    R_len_t moveNext() {
+        if (!asciiUsed) return rbiterator->next();
+        if (asciiIdx+1 >= (R_len_t)asciiBdr.size()) return BreakIterator::DONE;
+        return asciiBdr[++asciiIdx];
+    }
+
+    R_len_t movePrevious() {
+        if (!asciiUsed) return rbiterator->previous();
+        if (asciiIdx <= 0) return BreakIterator::DONE;
+        return asciiBdr[--asciiIdx];
+    }
+
 public:
 
     StriRuleBasedBreakIterator()
@@ -279,22 +269,14 @@ public:
     }
 
     StriRuleBasedBreakIterator& operator=(const StriBrkIterOptions& bropt) {
-        this->~StriRuleBasedBreakIterator();
+        close();
         (StriBrkIterOptions&) (*this) = (StriBrkIterOptions&)bropt;
         setEmptyOpts();
         return *this;
     }
 
     ~StriRuleBasedBreakIterator() {
-        if (rbiterator) {
-            delete rbiterator;
-            rbiterator = NULL;
-        }
-
-        if (searchText) {
-            utext_close(searchText);
-            searchText = NULL;
-        }
+        close();
     }
 
     void setupMatcher(const char* searchStr, R_len_t searchLen);
@@ -0,0 +1,758 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stri_stringi.h"
+#include "stri_brkiter.h"
+#include <unicode/rbbi.h>
+#include <unicode/utext.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+/* A specialised engine for word and line boundaries in ASCII strings.
+ *
+ * The rules below are the ASCII subset of ICU's default (root) word.txt
+ * and line.txt: the character classes are those of the ASCII code points
+ * (with ICU's tailorings, e.g., '@' is an ALetter and ':' is not a
+ * MidLetter) and the matching follows the RBBI semantics (chained rules,
+ * the boundary is placed at the end of the longest match).
+ *
+ * The engine is only used in place of an iterator whose rules are
+ * identical to the root ones, and only after it has reproduced the results
+ * of that very ICU build on a test corpus, see stri__brkiter_ascii_supported.
+ */
+
+
+enum StriASCIIWordClass {
+    STRI_WB_OTHER = 0, STRI_WB_CR, STRI_WB_LF, STRI_WB_NEWLINE,
+    STRI_WB_WSEGSPACE, STRI_WB_ALETTER, STRI_WB_NUMERIC,
+    STRI_WB_MIDNUMLET, STRI_WB_SINGLE_QUOTE, STRI_WB_MIDNUM,
+    STRI_WB_EXTENDNUMLET
+};
+
+
+enum StriASCIILineClass {
+    STRI_LB_AL = 0, STRI_LB_CM, STRI_LB_BA, STRI_LB_LF, STRI_LB_BK,
+    STRI_LB_CR, STRI_LB_SP, STRI_LB_EX, STRI_LB_QU, STRI_LB_PR, STRI_LB_PO,
+    STRI_LB_OP, STRI_LB_CP, STRI_LB_CL, STRI_LB_IS, STRI_LB_HY, STRI_LB_SY,
+    STRI_LB_NU
+};
+
+
+/** Word_Break property values of the ASCII characters
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static const uint8_t stri__brkiter_ascii_wb[128] = {
+#define O STRI_WB_OTHER
+#define L STRI_WB_ALETTER
+#define N STRI_WB_NUMERIC
+    O, O, O, O, O, O, O, O,  O, O, STRI_WB_LF, STRI_WB_NEWLINE, STRI_WB_NEWLINE, STRI_WB_CR, O, O,
+    O, O, O, O, O, O, O, O,  O, O, O, O, O, O, O, O,
+    /*  !"#$%&' */ STRI_WB_WSEGSPACE, O, O, O, O, O, O, STRI_WB_SINGLE_QUOTE,
+    /* ()*+,-./ */ O, O, O, O, STRI_WB_MIDNUM, O, STRI_WB_MIDNUMLET, O,
+    /* 01234567 */ N, N, N, N, N, N, N, N,
+    /* 89:;<=>? */ N, N, O, STRI_WB_MIDNUM, O, O, O, O,
+    /* @ABCDEFG */ L, L, L, L, L, L, L, L,
+    /* HIJKLMNO */ L, L, L, L, L, L, L, L,
+    /* PQRSTUVW */ L, L, L, L, L, L, L, L,
+    /* XYZ[\]^_ */ L, L, L, O, O, O, O, STRI_WB_EXTENDNUMLET,
+    /* `abcdefg */ O, L, L, L, L, L, L, L,
+    /* hijklmno */ L, L, L, L, L, L, L, L,
+    /* pqrstuvw */ L, L, L, L, L, L, L, L,
+    /* xyz{|}~  */ L, L, L, O, O, O, O, O
+#undef O
+#undef L
+#undef N
+};
+
+
+/** Line_Break property values of the ASCII characters
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static const uint8_t stri__brkiter_ascii_lb[128] = {
+#define C STRI_LB_CM
+#define A STRI_LB_AL
+    C, C, C, C, C, C, C, C,  C, STRI_LB_BA, STRI_LB_LF, STRI_LB_BK, STRI_LB_BK, STRI_LB_CR, C, C,
+    C, C, C, C, C, C, C, C,  C, C, C, C, C, C, C, C,
+    /*  !"#$%&' */ STRI_LB_SP, STRI_LB_EX, STRI_LB_QU, A, STRI_LB_PR, STRI_LB_PO, A, STRI_LB_QU,
+    /* ()*+,-./ */ STRI_LB_OP, STRI_LB_CP, A, STRI_LB_PR, STRI_LB_IS, STRI_LB_HY, STRI_LB_IS, STRI_LB_SY,
+    /* 01234567 */ STRI_LB_NU, STRI_LB_NU, STRI_LB_NU, STRI_LB_NU, STRI_LB_NU, STRI_LB_NU, STRI_LB_NU, STRI_LB_NU,
+    /* 89:;<=>? */ STRI_LB_NU, STRI_LB_NU, STRI_LB_IS, STRI_LB_IS, A, A, A, STRI_LB_EX,
+    /* @ABCDEFG */ A, A, A, A, A, A, A, A,
+    /* HIJKLMNO */ A, A, A, A, A, A, A, A,
+    /* PQRSTUVW */ A, A, A, A, A, A, A, A,
+    /* XYZ[\]^_ */ A, A, A, STRI_LB_OP, STRI_LB_PR, STRI_LB_CP, A, A,
+    /* `abcdefg */ A, A, A, A, A, A, A, A,
+    /* hijklmno */ A, A, A, A, A, A, A, A,
+    /* pqrstuvw */ A, A, A, A, A, A, A, A,
+    /* xyz{|}~  */ A, A, A, STRI_LB_OP, STRI_LB_BA, STRI_LB_CL, A, C
+#undef C
+#undef A
+};
+
+
+/** Word boundaries in an ASCII string
+ *
+ * UAX #29 rules WB3-WB13b restricted to ASCII (there are no Extend,
+ * Format, ZWJ, Katakana, Hebrew_Letter, or Regional_Indicator characters);
+ * the rule status is that of the last rule contributing to a segment:
+ * UBRK_WORD_NUMBER (100) for segments ending with a digit,
+ * UBRK_WORD_LETTER (200) for those ending with a letter, and
+ * for segments ending with an underscore, that of the preceding character
+ * (200 for "__", 0 for a lone "_").
+ *
+ * @param str string, ASCII
+ * @param n number of bytes
+ * @param bdr [out] boundaries, starting with 0 and ending with n
+ * @param status [out] status[k] is the rule status of [bdr[k-1], bdr[k]),
+ *     status[0]==0
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static void stri__brkiter_ascii_word(const char* str, R_len_t n,
+    std::vector<R_len_t>& bdr, std::vector<int32_t>& status)
+{
+    const uint8_t* s = (const uint8_t*)str;
+    const uint8_t* wb = stri__brkiter_ascii_wb;
+    R_len_t start = 0;
+    for (R_len_t i = 1; i <= n; ++i) {
+        if (i < n) {
+            uint8_t a = wb[s[i-1]];
+            uint8_t c = wb[s[i]];
+            bool join;
+            if (a == STRI_WB_CR && c == STRI_WB_LF)  // WB3
+                join = true;
+            else if (a <= STRI_WB_NEWLINE && a != STRI_WB_OTHER)  // WB3a
+                join = false;
+            else if (c <= STRI_WB_NEWLINE && c != STRI_WB_OTHER)  // WB3b
+                join = false;
+            else if (a == STRI_WB_WSEGSPACE && c == STRI_WB_WSEGSPACE)  // WB3d
+                join = true;
+            else if ((a == STRI_WB_ALETTER || a == STRI_WB_NUMERIC || a == STRI_WB_EXTENDNUMLET) &&
+                     (c == STRI_WB_ALETTER || c == STRI_WB_NUMERIC || c == STRI_WB_EXTENDNUMLET))
+                join = true;  // WB5, WB8, WB9, WB10, WB13a, WB13b
+            else if (a == STRI_WB_ALETTER && (c == STRI_WB_MIDNUMLET || c == STRI_WB_SINGLE_QUOTE))
+                join = (i+1 < n && wb[s[i+1]] == STRI_WB_ALETTER);  // WB6
+            else if ((a == STRI_WB_MIDNUMLET || a == STRI_WB_SINGLE_QUOTE) && c == STRI_WB_ALETTER)
+                join = (i >= 2 && wb[s[i-2]] == STRI_WB_ALETTER);  // WB7
+            else if (a == STRI_WB_NUMERIC && (c == STRI_WB_MIDNUMLET || c == STRI_WB_SINGLE_QUOTE || c == STRI_WB_MIDNUM))
+                join = (i+1 < n && wb[s[i+1]] == STRI_WB_NUMERIC);  // WB12
+            else if ((a == STRI_WB_MIDNUMLET || a == STRI_WB_SINGLE_QUOTE || a == STRI_WB_MIDNUM) && c == STRI_WB_NUMERIC)
+                join = (i >= 2 && wb[s[i-2]] == STRI_WB_NUMERIC);  // WB11
+            else
+                join = false;  // WB999
+
+            if (join) continue;
+        }
+
+        int32_t cur_status = UBRK_WORD_NONE;
+        uint8_t z = wb[s[i-1]];
+        if (z == STRI_WB_ALETTER)
+            cur_status = UBRK_WORD_LETTER;
+        else if (z == STRI_WB_NUMERIC)
+            cur_status = UBRK_WORD_NUMBER;
+        else if (z == STRI_WB_EXTENDNUMLET && i-1 > start)
+            cur_status = (wb[s[i-2]] == STRI_WB_NUMERIC)?UBRK_WORD_NUMBER:UBRK_WORD_LETTER;
+
+        bdr.push_back(i);
+        status.push_back(cur_status);
+        start = i;
+    }
+}
+
+
+#define STRI__LB(x) (1u<<(x))
+#define STRI__LB_BREAKS     (STRI__LB(STRI_LB_BK)|STRI__LB(STRI_LB_CR)|STRI__LB(STRI_LB_LF))
+#define STRI__LB_ANY        ((1u<<(STRI_LB_NU+1))-1)
+#define STRI__LB_CAN_FOLLOW_IS (STRI__LB_BREAKS|STRI__LB(STRI_LB_SP)|\
+    STRI__LB(STRI_LB_CL)|STRI__LB(STRI_LB_CP)|STRI__LB(STRI_LB_EX)|\
+    STRI__LB(STRI_LB_IS)|STRI__LB(STRI_LB_SY)|STRI__LB(STRI_LB_QU)|\
+    STRI__LB(STRI_LB_BA)|STRI__LB(STRI_LB_HY)|STRI__LB(STRI_LB_AL))
+
+
+/** Line break rules of the form X $CM* Y (LB4, LB7, LB13, LB15d, LB19, LB21,
+ *  LB23, LB24, LB28, LB29, LB30): the Y-s for each X
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+#define STRI__LB_AFTER_ANY (STRI__LB_BREAKS|STRI__LB(STRI_LB_SP)|\
+    STRI__LB(STRI_LB_CL)|STRI__LB(STRI_LB_CP)|STRI__LB(STRI_LB_EX)|\
+    STRI__LB(STRI_LB_SY)|STRI__LB(STRI_LB_IS)|STRI__LB(STRI_LB_QU)|\
+    STRI__LB(STRI_LB_BA)|STRI__LB(STRI_LB_HY))
+static const uint32_t stri__brkiter_ascii_lb_pairs[STRI_LB_NU+1] = {
+    /* AL */ STRI__LB_AFTER_ANY|STRI__LB(STRI_LB_NU)|STRI__LB(STRI_LB_PR)|
+             STRI__LB(STRI_LB_PO)|STRI__LB(STRI_LB_AL)|STRI__LB(STRI_LB_OP),
+    /* CM */ 0,
+    /* BA */ STRI__LB_AFTER_ANY,
+    /* LF */ 0,
+    /* BK */ 0,
+    /* CR */ 0,
+    /* SP */ 0,
+    /* EX */ STRI__LB_AFTER_ANY,
+    /* QU */ STRI__LB_AFTER_ANY,
+    /* PR */ STRI__LB_AFTER_ANY|STRI__LB(STRI_LB_AL),
+    /* PO */ STRI__LB_AFTER_ANY|STRI__LB(STRI_LB_AL),
+    /* OP */ STRI__LB_AFTER_ANY,
+    /* CP */ STRI__LB_AFTER_ANY|STRI__LB(STRI_LB_AL)|STRI__LB(STRI_LB_NU),
+    /* CL */ STRI__LB_AFTER_ANY,
+    /* IS */ STRI__LB_AFTER_ANY|STRI__LB(STRI_LB_AL),
+    /* HY */ STRI__LB_AFTER_ANY,
+    /* SY */ STRI__LB_AFTER_ANY,
+    /* NU */ STRI__LB_AFTER_ANY|STRI__LB(STRI_LB_AL)|STRI__LB(STRI_LB_OP)
+};
+
+
+/** Line boundaries in an ASCII string
+ *
+ * Starting at a boundary, all the rules of ICU's line.txt that may match
+ * ASCII text are tried; rules may also start at the last character of
+ * any complete match (chaining). The next boundary follows the character
+ * at which the furthest match ends. Only the rules ending with
+ * a mandatory break have the UBRK_LINE_HARD (100) status.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriASCIILineBreaker {
+private:
+
+    const uint8_t* s;
+    R_len_t n;
+    R_len_t start;       // current segment start
+    R_len_t reach;       // the furthest match end (inclusive)
+    int32_t reach_status;
+    R_len_t num_last;    // end of the last (NU|SY|IS)* run matched by LB25
+    std::vector<char> ends;  // ends of complete matches in the current segment
+
+    inline uint32_t cls(R_len_t i) const {
+        return (i < n)?STRI__LB(stri__brkiter_ascii_lb[s[i]]):0u;
+    }
+
+    inline R_len_t skipCM(R_len_t i) const {
+        while (i < n && stri__brkiter_ascii_lb[s[i]] == STRI_LB_CM) ++i;
+        return i;
+    }
+
+    inline void matchEnd(R_len_t i, int32_t rule_status=UBRK_LINE_SOFT) {
+        ends[i] = 1;
+        if (i > reach) {
+            reach = i;
+            reach_status = rule_status;
+        }
+        else if (i == reach && rule_status > reach_status)
+            reach_status = rule_status;
+    }
+
+    void matchNumber(R_len_t i);
+    void matchAll(R_len_t i);
+
+public:
+
+    StriASCIILineBreaker(const char* str, R_len_t _n)
+        : s((const uint8_t*)str), n(_n), ends(_n+1, 0) {
+    }
+
+    void getBoundaries(std::vector<R_len_t>& bdr, std::vector<int32_t>& status);
+};
+
+
+/** LB25 (ICU's regular expression variant), starting at i
+ *
+ * (($PR | $PO) $CM*)? (($OP | $HY) $CM*)? ($IS $CM*)?
+ *     $NU ($CM* ($NU | $SY | $IS))* ($CM* ($CL | $CP))? ($CM* ($PR | $PO))?
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriASCIILineBreaker::matchNumber(R_len_t i)
+{
+    const uint32_t PRPO = STRI__LB(STRI_LB_PR)|STRI__LB(STRI_LB_PO);
+    const uint32_t OPHY = STRI__LB(STRI_LB_OP)|STRI__LB(STRI_LB_HY);
+
+    // all the combinations of the optional prefixes:
+    R_len_t nu[8];
+    int nnu = 0;
+    for (int a = 0; a < 2; ++a) {
+        R_len_t j = i;
+        if (a) {
+            if (!(cls(j) & PRPO)) continue;
+            j = skipCM(j+1);
+        }
+        for (int b = 0; b < 2; ++b) {
+            R_len_t k = j;
+            if (b) {
+                if (!(cls(k) & OPHY)) continue;
+                k = skipCM(k+1);
+            }
+            for (int c = 0; c < 2; ++c) {
+                R_len_t l = k;
+                if (c) {
+                    if (!(cls(l) & STRI__LB(STRI_LB_IS))) continue;
+                    l = skipCM(l+1);
+                }
+                if (cls(l) & STRI__LB(STRI_LB_NU)) nu[nnu++] = l;
+            }
+        }
+    }
+
+    for (int q = 0; q < nnu; ++q) {
+        R_len_t j = nu[q];
+        // a $NU within the run matched previously yields a subset
+        // of the matches already found
+        if (j <= num_last) continue;
+
+        matchEnd(j);
+        R_len_t last = j;
+        while (true) {
+            R_len_t k = skipCM(last+1);
+            if (!(cls(k) & (STRI__LB(STRI_LB_NU)|STRI__LB(STRI_LB_SY)|STRI__LB(STRI_LB_IS))))
+                break;
+            matchEnd(k);
+            last = k;
+        }
+        num_last = last;
+
+        R_len_t k = skipCM(last+1);
+        if (cls(k) & (STRI__LB(STRI_LB_CL)|STRI__LB(STRI_LB_CP))) {
+            matchEnd(k);
+            R_len_t l = skipCM(k+1);
+            if (cls(l) & PRPO) matchEnd(l);
+        }
+        else if (cls(k) & PRPO)
+            matchEnd(k);
+    }
+}
+
+
+/** Try all the rules starting at i
+ *
+ * Most rules are of the form X $CM* Y: for each X, the Y-s are
+ * given in stri__brkiter_ascii_lb_pairs. A run of combining marks at the
+ * start of a segment behaves like AL (^$CM+ Y); elsewhere, no rule
+ * starts with a CM.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriASCIILineBreaker::matchAll(R_len_t i)
+{
+    const uint32_t AL = STRI__LB(STRI_LB_AL);
+    const uint32_t NU = STRI__LB(STRI_LB_NU);
+    const uint32_t OP = STRI__LB(STRI_LB_OP);
+    const uint32_t SP = STRI__LB(STRI_LB_SP);
+    const uint32_t IS = STRI__LB(STRI_LB_IS);
+    const uint32_t CM = STRI__LB(STRI_LB_CM);
+    const uint32_t CLCPEXSY = STRI__LB(STRI_LB_CL)|STRI__LB(STRI_LB_CP)|
+                              STRI__LB(STRI_LB_EX)|STRI__LB(STRI_LB_SY);
+
+    uint8_t a = stri__brkiter_ascii_lb[s[i]];
+
+    // LB31: any single character; LB4, LB5: mandatory breaks
+    if (STRI__LB(a) & STRI__LB_BREAKS) {
+        matchEnd(i, UBRK_LINE_HARD);
+        if (a == STRI_LB_CR && (cls(i+1) & STRI__LB(STRI_LB_LF)))
+            matchEnd(i+1, UBRK_LINE_HARD);
+        return;
+    }
+    if (i == start) matchEnd(i);  // otherwise i <= reach already
+
+    if (a == STRI_LB_SP) {
+        // LB4, LB7, LB13 (no combining marks after a space)
+        uint32_t c = cls(i+1);
+        if (c & STRI__LB_BREAKS)
+            matchEnd(i+1, UBRK_LINE_HARD);
+        else if (c & (SP|CLCPEXSY))
+            matchEnd(i+1);
+        else if (c & IS) {
+            // LB15c, LB15d: SP ÷ IS NU, × IS
+            const uint32_t lookahead = STRI__LB_ANY & ~(STRI__LB_CAN_FOLLOW_IS|NU|CM);
+            if (cls(i+2) & lookahead) matchEnd(i+1);
+            R_len_t j = skipCM(i+2);
+            if (j > i+2 && (cls(j) & lookahead)) matchEnd(j-1);
+            if (j >= n) matchEnd(j-1);
+            else if (cls(j) & STRI__LB_CAN_FOLLOW_IS) matchEnd(j);
+        }
+        return;
+    }
+
+    if (a == STRI_LB_CM) {
+        if (i != start) return;
+        a = STRI_LB_AL;  // LB10
+    }
+
+    // LB9: X $CM*
+    R_len_t j = i+1;
+    for (; j < n && stri__brkiter_ascii_lb[s[j]] == STRI_LB_CM; ++j)
+        matchEnd(j);
+
+    uint32_t c = cls(j);
+    uint32_t y = stri__brkiter_ascii_lb_pairs[a];
+    if (i == start && a == STRI_LB_HY) y |= AL;  // LB20.1 (ICU): ^HY × AL
+    if (c & y)
+        matchEnd(j, (c & STRI__LB_BREAKS)?UBRK_LINE_HARD:UBRK_LINE_SOFT);
+
+    switch (a) {
+        case STRI_LB_OP: {
+            // LB14: OP SP* ×
+            R_len_t k = j;
+            while (cls(k) & SP) ++k;
+            if (k < n) matchEnd(k);
+            if (k > j) {  // $OP $CM* $SP+ $CM+ $AL_FOLLOW?
+                R_len_t l = k;
+                for (; cls(l) & CM; ++l) matchEnd(l);
+                if (l > k && (cls(l) & ~CM)) matchEnd(l);
+            }
+            matchNumber(i);
+            break;
+        }
+
+        case STRI_LB_QU: {
+            // LB19: QU ×
+            if (j < n) matchEnd(j);
+            // LB15: QU SP* × OP
+            R_len_t k = j;
+            while (cls(k) & SP) ++k;
+            if (cls(k) & OP) matchEnd(k);
+            break;
+        }
+
+        case STRI_LB_PR:
+        case STRI_LB_PO:
+        case STRI_LB_HY:
+        case STRI_LB_IS:
+        case STRI_LB_NU:
+            matchNumber(i);  // LB25
+            break;
+    }
+}
+
+
+/** Determine all line boundaries
+ *
+ * @param bdr [out] boundaries, starting with 0 and ending with n
+ * @param status [out] status[k] is the rule status of [bdr[k-1], bdr[k]),
+ *     status[0]==0
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriASCIILineBreaker::getBoundaries(std::vector<R_len_t>& bdr, std::vector<int32_t>& status)
+{
+    start = 0;
+    while (start < n) {
+        reach = start-1;
+        reach_status = UBRK_LINE_SOFT;
+        num_last = start-1;
+        // rules may start at the segment start and at the ends of
+        // complete matches; the latter are all < reach+1
+        for (R_len_t i = start; i <= reach || i == start; ++i) {
+            if (i != start && !ends[i]) continue;
+
+            if (i >= reach) {
+                // fast path: a run of letters (LB28), nothing pending
+                R_len_t k = i;
+                while (k+1 < n && stri__brkiter_ascii_lb[s[k]] == STRI_LB_AL &&
+                        stri__brkiter_ascii_lb[s[k+1]] == STRI_LB_AL)
+                    ++k;
+                if (k > i) {
+                    reach = k;
+                    reach_status = UBRK_LINE_SOFT;
+                    i = k;
+                }
+            }
+
+            matchAll(i);
+        }
+
+        for (R_len_t i = start; i <= reach; ++i)
+            ends[i] = 0;
+
+        start = reach+1;
+        bdr.push_back(start);
+        status.push_back(reach_status);
+    }
+}
+
+
+/** Get word or line boundaries in an ASCII string
+ *
+ * @param type UBRK_WORD or UBRK_LINE
+ * @param str string
+ * @param n number of bytes
+ * @param bdr [out] boundaries, starting with 0 and ending with n
+ * @param status [out] status[k] is the rule status of [bdr[k-1], bdr[k]),
+ *     status[0]==0
+ * @return false if the string is not ASCII (nothing is done then)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool stri__brkiter_ascii_boundaries(UBreakIteratorType type,
+    const char* str, R_len_t n,
+    std::vector<R_len_t>& bdr, std::vector<int32_t>& status)
+{
+    for (R_len_t i = 0; i < n; ++i)
+        if ((uint8_t)str[i] >= 0x80) return false;
+
+    bdr.clear();
+    status.clear();
+    bdr.push_back(0);
+    status.push_back(0);
+
+    if (type == UBRK_WORD)
+        stri__brkiter_ascii_word(str, n, bdr, status);
+    else
+        StriASCIILineBreaker(str, n).getBoundaries(bdr, status);
+
+    return true;
+}
+
+
+/** Get the boundaries and rule statuses as reported by ICU
+ *
+ * @param briter break iterator
+ * @param str string
+ * @param str_text [in/out] UText to reuse, to be closed by the caller
+ * @param bdr [out] boundaries
+ * @param status [out] rule statuses, see stri__brkiter_ascii_boundaries
+ * @return false on error
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__brkiter_ascii_icu(BreakIterator* briter, const std::string& str,
+    UText*& str_text, std::vector<R_len_t>& bdr, std::vector<int32_t>& status)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    str_text = utext_openUTF8(str_text, str.data(), str.size(), &err);
+    if (U_SUCCESS(err)) briter->setText(str_text, err);
+    if (U_FAILURE(err)) return false;
+
+    bdr.clear();
+    status.clear();
+    for (int32_t pos = briter->first(); pos != BreakIterator::DONE; pos = briter->next()) {
+        bdr.push_back(pos);
+        status.push_back((pos == 0)?0:briter->getRuleStatus());
+    }
+    return true;
+}
+
+
+/** Compare the engine against ICU on a test corpus
+ *
+ * The corpus consists of a de Bruijn sequence (featuring every triple
+ * of representatives of the ASCII word and line break classes),
+ * all the ASCII characters, and pseudo-random strings.
+ *
+ * @param type UBRK_WORD or UBRK_LINE
+ * @param briter reference iterator
+ * @return true if all the boundaries and rule statuses agree
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__brkiter_ascii_selfcheck(UBreakIteratorType type, BreakIterator* briter)
+{
+    const char* classes = "a0 .,:'\"_-\t\n\r\v!$%()}/\x01#";
+    const char* alphabet = "aZq09 .,:;'\"_@-\t\n\r\v\f!?()[]{}$%+/\\#&*<=>^`~|\x01\x1f\x7f";
+    const int nclasses = (int)strlen(classes);
+    const int nalphabet = (int)strlen(alphabet);
+
+    std::vector<R_len_t> bdr, icu_bdr;
+    std::vector<int32_t> status, icu_status;
+    std::string str;
+    UText* str_text = NULL;
+    uint32_t seed = 20261019u;
+    bool ok = true;
+
+    for (int t = 0; ok && t < 512; ++t) {
+        str.clear();
+        if (t == 0) {
+            // Duval's algorithm: Lyndon words of lengths dividing 3
+            std::vector<int> w(1, -1);
+            while (!w.empty()) {
+                w.back()++;
+                size_t m = w.size();
+                if (3 % m == 0)
+                    for (size_t j = 0; j < m; ++j) str.push_back(classes[w[j]]);
+                while (w.size() < 3) w.push_back(w[w.size()-m]);
+                while (!w.empty() && w.back() == nclasses-1) w.pop_back();
+            }
+            str.append(str, 0, 2);  // linearise
+        }
+        else if (t == 1) {
+            for (int c = 1; c < 128; ++c) str.push_back((char)c);
+        }
+        else {
+            seed = seed*1103515245u+12345u;
+            R_len_t len = 1+(R_len_t)((seed>>16)%48);
+            for (R_len_t k = 0; k < len; ++k) {
+                seed = seed*1103515245u+12345u;
+                str.push_back(alphabet[(seed>>16)%nalphabet]);
+            }
+        }
+
+        if (!stri__brkiter_ascii_icu(briter, str, str_text, icu_bdr, icu_status)) {
+            ok = false;
+            break;
+        }
+
+        stri__brkiter_ascii_boundaries(type, str.data(), (R_len_t)str.size(), bdr, status);
+        ok = (bdr == icu_bdr && status == icu_status);
+    }
+
+    if (str_text) utext_close(str_text);
+    return ok;
+}
+
+
+/** Can the ASCII engine stand in for a given break iterator?
+ *
+ * This is the case for word and line break iterators whose rules are
+ * the default ones (most locales do not tailor them), provided that the
+ * engine agrees with the ICU build in use (checked once per type).
+ *
+ * @param type break iterator type
+ * @param briter break iterator
+ * @return logical value
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool stri__brkiter_ascii_supported(UBreakIteratorType type, const BreakIterator* briter)
+{
+    static int ok[2] = {-1, -1};  // unknown/no/yes for word and line
+    static UnicodeString rules[2];
+
+    if (type != UBRK_WORD && type != UBRK_LINE) return false;
+    const RuleBasedBreakIterator* rbbi = dynamic_cast<const RuleBasedBreakIterator*>(briter);
+    if (!rbbi) return false;
+
+    int which = (type == UBRK_WORD)?0:1;
+    if (ok[which] < 0) {
+        ok[which] = 0;
+        UErrorCode status = U_ZERO_ERROR;
+        BreakIterator* root = (type == UBRK_WORD)
+            ?BreakIterator::createWordInstance(Locale::getRoot(), status)
+            :BreakIterator::createLineInstance(Locale::getRoot(), status);
+        RuleBasedBreakIterator* rbroot = dynamic_cast<RuleBasedBreakIterator*>(root);
+        if (U_SUCCESS(status) && rbroot) {
+            rules[which] = rbroot->getRules();
+            if (!rules[which].isEmpty() && stri__brkiter_ascii_selfcheck(type, root))
+                ok[which] = 1;
+        }
+        if (root) delete root;
+    }
+
+    return ok[which] == 1 && rbbi->getRules() == rules[which];
+}
+
+
+/** Compare the ASCII engine against ICU's root break iterator
+ *  on the given strings [for testing only]
+ *
+ * @param str character vector, ASCII
+ * @param type single string, \code{"word"} or \code{"line_break"}
+ * @return list with \code{supported} (whether the engine is used with
+ *    this ICU build at all) and \code{mismatches} (a character vector
+ *    giving the strings for which the boundaries or rule statuses differ,
+ *    followed by ICU's and the engine's results)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_test_brkiter_ascii(SEXP str, SEXP type)
+{
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    const char* type_val = stri__prepare_arg_string_1_notNA(type, "type");
+    const char* type_opts[] = {"word", "line_break", NULL};
+    int type_cur = stri__match_arg(type_val, type_opts);
+    if (type_cur < 0) {
+        UNPROTECT(1);
+        Rf_error(MSG__INCORRECT_MATCH_OPTION, "type"); // allowed here
+    }
+    UBreakIteratorType type_brk = (type_cur == 0)?UBRK_WORD:UBRK_LINE;
+
+    BreakIterator* briter = NULL;
+    UText* str_text = NULL;
+    STRI__ERROR_HANDLER_BEGIN(1)
+    UErrorCode status = U_ZERO_ERROR;
+    briter = (type_brk == UBRK_WORD)
+        ?BreakIterator::createWordInstance(Locale::getRoot(), status)
+        :BreakIterator::createLineInstance(Locale::getRoot(), status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+    std::vector<std::string> mismatches;
+    std::vector<R_len_t> bdr, icu_bdr;
+    std::vector<int32_t> bdr_status, icu_status;
+    R_len_t str_n = LENGTH(str);
+    for (R_len_t i = 0; i < str_n; ++i) {
+        if (STRING_ELT(str, i) == NA_STRING) continue;
+        std::string s(CHAR(STRING_ELT(str, i)), LENGTH(STRING_ELT(str, i)));
+        if (!stri__brkiter_ascii_boundaries(type_brk, s.data(), (R_len_t)s.size(),
+                bdr, bdr_status))
+            throw StriException(MSG__INCORRECT_NAMED_ARG "; " MSG__EXPECTED_ASCII, "str");
+        if (!stri__brkiter_ascii_icu(briter, s, str_text, icu_bdr, icu_status))
+            throw StriException(MSG__INTERNAL_ERROR);
+        if (bdr == icu_bdr && bdr_status == icu_status)
+            continue;
+
+        std::string m(s);
+        const std::vector<R_len_t>* b[2] = {&icu_bdr, &bdr};
+        const std::vector<int32_t>* st[2] = {&icu_status, &bdr_status};
+        for (int k = 0; k < 2; ++k) {
+            m += (k == 0)?" | ICU:":" | ASCII:";
+            for (size_t j = 0; j < b[k]->size(); ++j)
+                m += " " + std::to_string((*b[k])[j]) + "/" + std::to_string((*st[k])[j]);
+        }
+        mismatches.push_back(m);
+    }
+
+    bool supported = stri__brkiter_ascii_supported(type_brk, briter);
+
+    if (str_text) {
+        utext_close(str_text);
+        str_text = NULL;
+    }
+    delete briter;
+    briter = NULL;
+
+    SEXP ret, ret_mismatches;
+    STRI__PROTECT(ret = Rf_allocVector(VECSXP, 2));
+    SET_VECTOR_ELT(ret, 0, Rf_ScalarLogical(supported));
+    STRI__PROTECT(ret_mismatches = Rf_allocVector(STRSXP, mismatches.size()));
+    for (size_t k = 0; k < mismatches.size(); ++k)
+        SET_STRING_ELT(ret_mismatches, k,
+            Rf_mkCharLenCE(mismatches[k].c_str(), (int)mismatches[k].size(), CE_UTF8));
+    SET_VECTOR_ELT(ret, 1, ret_mismatches);
+    Rf_setAttrib(ret, R_NamesSymbol,
+        stri__make_character_vector_char_ptr(2, "supported", "mismatches"));
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END({
+        if (str_text) utext_close(str_text);
+        if (briter) delete briter;
+    })
+}
@@ -31,16 +31,358 @@
 
 #include "stri_stringi.h"
 #include "stri_callables.h"
+#include "stri_container_bytesearch.h"
+#include <unicode/ucol.h>
+#include <unicode/normalizer2.h>
+#include <unicode/bytestream.h>
+#include <cstring>
+#include <new>
+#include <string>
 
 
+#define STRI__MK_CALLABLE(name) \
+    {#name, (DL_FUNC)(void (*) (void))(&name), 0/*unused*/}
+
 const extern R_CallMethodDef stri_callables[] =
 {
-    {"stric_u_hasBinaryProperty", (DL_FUNC)(void (*) (void))(&stric_u_hasBinaryProperty), 0/*unused*/},
+    STRI__MK_CALLABLE(stric_u_hasBinaryProperty),
+    STRI__MK_CALLABLE(stric_capi_version),
+    STRI__MK_CALLABLE(stric_utf8_invalid_offset),
+    STRI__MK_CALLABLE(stric_utf8_length),
+    STRI__MK_CALLABLE(stric_utf8_width),
+    STRI__MK_CALLABLE(stric_utf8_nfc),
+    STRI__MK_CALLABLE(stric_matcher_new),
+    STRI__MK_CALLABLE(stric_matcher_free),
+    STRI__MK_CALLABLE(stric_matcher_reset),
+    STRI__MK_CALLABLE(stric_matcher_find_next),
+    STRI__MK_CALLABLE(stric_matcher_find_last),
+    STRI__MK_CALLABLE(stric_collator_new),
+    STRI__MK_CALLABLE(stric_collator_free),
+    STRI__MK_CALLABLE(stric_collator_compare),
+    STRI__MK_CALLABLE(stric_collator_sort_key),
     {NULL, NULL, 0}
 };
 
 
+/* The functions below are called by other packages from C, possibly
+ * from many threads: none of them may throw exceptions or call the R API
+ * (except for stric_collator_new); errors are reported via return values.
+ */
+
+
+/** Fixed pattern matcher: owns a copy of the pattern
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+struct stric_matcher {
+    std::string pattern;
+    StriByteSearchMatcher* matcher;
+};
+
+
+/** Collator
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+struct stric_collator {
+    UCollator* col;
+};
+
+
 int stric_u_hasBinaryProperty(int c, int which)
 {
     return (int)u_hasBinaryProperty((UChar32)c, (UProperty)which);
 }
+
+
+/** Version of the C API
+ *
+ * @return STRI__CAPI_VERSION
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_capi_version()
+{
+    return STRI__CAPI_VERSION;
+}
+
+
+/** Validate a UTF-8 string
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return -1 if s is valid, the byte offset of the first ill-formed
+ *   sequence otherwise
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_utf8_invalid_offset(const char* s, int n)
+{
+    return (int)stri__utf8_invalid_offset(s, (R_len_t)n);
+}
+
+
+/** Number of code points in a UTF-8 string
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return length or -1 if s is not valid UTF-8
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_utf8_length(const char* s, int n)
+{
+    if (stri__utf8_invalid_offset(s, (R_len_t)n) >= 0)
+        return -1;
+    return (int)stri__utf8_count_codepoints(s, (R_len_t)n);
+}
+
+
+/** Width of a UTF-8 string, see stri_width
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return width or -1 if s is not valid UTF-8
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_utf8_width(const char* s, int n)
+{
+    if (stri__utf8_invalid_offset(s, (R_len_t)n) >= 0)
+        return -1;
+
+    try {
+        return stri__width_string(s, n);
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+
+/** Normalise a UTF-8 string to NFC
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @param buf [out] output buffer (not NUL-terminated)
+ * @param buf_size size of buf; if smaller than the return value,
+ *    the contents of buf are unspecified and the call should be repeated
+ *    with a larger buffer
+ * @return number of bytes in the normalised string or -1 on error
+ *    (e.g., if s is not valid UTF-8)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_utf8_nfc(const char* s, int n, char* buf, int buf_size)
+{
+    if (stri__utf8_invalid_offset(s, (R_len_t)n) >= 0)
+        return -1;
+
+    try {
+        UErrorCode status = U_ZERO_ERROR;
+        const Normalizer2* nfc = Normalizer2::getNFCInstance(status);
+        if (U_FAILURE(status)) return -1;
+
+        StringPiece sp(s, n);
+        if (nfc->isNormalizedUTF8(sp, status) && U_SUCCESS(status)) {
+            if (n <= buf_size) memcpy(buf, s, (size_t)n);
+            return n;
+        }
+
+        status = U_ZERO_ERROR;
+        std::string out;
+        StringByteSink<std::string> sink(&out);
+        nfc->normalizeUTF8(0, sp, sink, NULL, status);
+        if (U_FAILURE(status) || out.size() > (size_t)INT_MAX) return -1;
+
+        if ((int)out.size() <= buf_size) memcpy(buf, out.data(), out.size());
+        return (int)out.size();
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+
+/** Create a fixed pattern matcher
+ *
+ * @param pattern non-empty pattern, valid UTF-8 (copied)
+ * @param pattern_len number of bytes in pattern
+ * @param case_insensitive see stri_opts_fixed
+ * @param overlap see stri_opts_fixed
+ * @return a new matcher, to be freed with stric_matcher_free,
+ *    or NULL on error
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+stric_matcher* stric_matcher_new(const char* pattern, int pattern_len,
+    int case_insensitive, int overlap)
+{
+    if (!pattern || pattern_len <= 0 ||
+            stri__utf8_invalid_offset(pattern, (R_len_t)pattern_len) >= 0)
+        return NULL;
+
+    stric_matcher* matcher = NULL;
+    try {
+        matcher = new stric_matcher;
+        matcher->matcher = NULL;
+        matcher->pattern.assign(pattern, (size_t)pattern_len);
+        matcher->matcher = StriContainerByteSearch::newMatcher(
+            matcher->pattern.data(), (R_len_t)pattern_len,
+            case_insensitive != 0, overlap != 0);
+        return matcher;
+    }
+    catch (...) {
+        if (matcher) delete matcher;
+        return NULL;
+    }
+}
+
+
+/** Free a fixed pattern matcher
+ *
+ * @param matcher matcher or NULL
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void stric_matcher_free(stric_matcher* matcher)
+{
+    if (!matcher) return;
+    if (matcher->matcher) delete matcher->matcher;
+    delete matcher;
+}
+
+
+/** Set the string to search in
+ *
+ * @param matcher
+ * @param s valid UTF-8 string (not copied, must outlive the search)
+ * @param n number of bytes in s
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void stric_matcher_reset(stric_matcher* matcher, const char* s, int n)
+{
+    matcher->matcher->reset(s, (R_len_t)n);
+}
+
+
+/** Find the next match
+ *
+ * @param matcher
+ * @param match_len [out] length of the match in bytes; may be NULL
+ * @return byte offset of the match or -1 if there are no more matches
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_matcher_find_next(stric_matcher* matcher, int* match_len)
+{
+    R_len_t start = matcher->matcher->findNext();
+    if (start == USEARCH_DONE) return -1;
+    if (match_len) *match_len = (int)matcher->matcher->getMatchedLength();
+    return (int)start;
+}
+
+
+/** Find the last match
+ *
+ * @param matcher
+ * @param match_len [out] length of the match in bytes; may be NULL
+ * @return byte offset of the match or -1 if there is no match
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_matcher_find_last(stric_matcher* matcher, int* match_len)
+{
+    R_len_t start = matcher->matcher->findLast();
+    if (start == USEARCH_DONE) return -1;
+    if (match_len) *match_len = (int)matcher->matcher->getMatchedLength();
+    return (int)start;
+}
+
+
+/** Create a collator
+ *
+ * Calls the R API: may only be used from the main thread,
+ * and may call Rf_error.
+ *
+ * @param opts_collator see stri_opts_collator
+ * @return a new collator, to be freed with stric_collator_free
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+stric_collator* stric_collator_new(SEXP opts_collator)
+{
+    UCollator* col = stri__ucol_open(opts_collator);  // may call Rf_error
+    stric_collator* collator = new (std::nothrow) stric_collator;
+    if (!collator) {
+        ucol_close(col);
+        Rf_error(MSG__MEM_ALLOC_ERROR); // error() allowed here
+    }
+    collator->col = col;
+    return collator;
+}
+
+
+/** Free a collator
+ *
+ * @param collator collator or NULL
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void stric_collator_free(stric_collator* collator)
+{
+    if (!collator) return;
+    if (collator->col) ucol_close(collator->col);
+    delete collator;
+}
+
+
+/** Compare two UTF-8 strings
+ *
+ * @param collator
+ * @param s1 string
+ * @param n1 number of bytes in s1
+ * @param s2 string
+ * @param n2 number of bytes in s2
+ * @return -1, 0, or 1 (less, equal, greater) or -2 on error
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_collator_compare(const stric_collator* collator,
+    const char* s1, int n1, const char* s2, int n2)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    int ret = (int)ucol_strcollUTF8(collator->col, s1, n1, s2, n2, &status);
+    if (U_FAILURE(status)) return -2;
+    return ret;
+}
+
+
+/** Get the sort key of a UTF-8 string, see stri_sort_key
+ *
+ * @param collator
+ * @param s string
+ * @param n number of bytes in s
+ * @param buf [out] output buffer; the key is NUL-terminated
+ * @param buf_size size of buf; if smaller than the return value,
+ *    the contents of buf are unspecified and the call should be repeated
+ *    with a larger buffer
+ * @return number of bytes in the key, including the terminating NUL,
+ *    or -1 on error
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stric_collator_sort_key(const stric_collator* collator,
+    const char* s, int n, unsigned char* buf, int buf_size)
+{
+    try {
+        UnicodeString str = UnicodeString::fromUTF8(StringPiece(s, n));
+        int32_t ret = ucol_getSortKey(collator->col, str.getBuffer(), str.length(),
+            (uint8_t*)buf, (buf)?buf_size:0);
+        return (ret > 0)?(int)ret:-1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
@@ -29,6 +29,9 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#ifndef __stri_callables_h
+#define __stri_callables_h
+
 #include "stri_stringi.h"
 #include <R_ext/Rdynload.h>
 
@@ -45,9 +48,44 @@ stringi's shared library via a call to:
 #include <R_ext/Rdynload.h>
 R_GetCCallable("stringi", "function_name");
 
+The stric_capi_* and stric_utf8_*, stric_matcher_*, stric_collator_* functions
+form a versioned C API; see inst/include/stringiAPI.h (to be used with
+LinkingTo: stringi) for the documentation. Existing signatures are never
+changed; new functions increase STRI__CAPI_VERSION.
+
 If you would like to get access to any additional functions (e.g., from ICU),
 feel free to contact the maintainer of stringi.
 */
 
 
+/// must be the same as STRINGI_CAPI_VERSION in inst/include/stringiAPI.h
+#define STRI__CAPI_VERSION 1
+
+struct stric_matcher;   // opaque to the callers
+struct stric_collator;  // opaque to the callers
+
+
 int stric_u_hasBinaryProperty(int c, int which);
+
+int stric_capi_version();
+
+int stric_utf8_invalid_offset(const char* s, int n);
+int stric_utf8_length(const char* s, int n);
+int stric_utf8_width(const char* s, int n);
+int stric_utf8_nfc(const char* s, int n, char* buf, int buf_size);
+
+stric_matcher* stric_matcher_new(const char* pattern, int pattern_len,
+    int case_insensitive, int overlap);
+void stric_matcher_free(stric_matcher* matcher);
+void stric_matcher_reset(stric_matcher* matcher, const char* s, int n);
+int stric_matcher_find_next(stric_matcher* matcher, int* match_len);
+int stric_matcher_find_last(stric_matcher* matcher, int* match_len);
+
+stric_collator* stric_collator_new(SEXP opts_collator);
+void stric_collator_free(stric_collator* collator);
+int stric_collator_compare(const stric_collator* collator,
+    const char* s1, int n1, const char* s2, int n2);
+int stric_collator_sort_key(const stric_collator* collator,
+    const char* s, int n, unsigned char* buf, int buf_size);
+
+#endif
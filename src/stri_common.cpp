@@ -166,6 +166,53 @@ R_len_t stri__recycling_rule(bool enableWarning, int n, ...)
 }
 
 
+/**
+ *  Calculate the length of the output vector when applying a vectorized
+ *  operation on >= 2 (possibly long) vectors
+ *
+ *  Same as \code{stri__recycling_rule}, but all the lengths must be passed
+ *  as \code{R_xlen_t}, e.g., as returned by \code{XLENGTH}
+ *
+ *  @param enableWarning enable warning in case of multiple calls to this function
+ *  @param n number of vectors to recycle
+ *  @param ... vector lengths (R_xlen_t)
+ *  @return max of the given lengths or 0 iff any ns* is <= 0
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_xlen_t stri__recycling_rule_xlen(bool enableWarning, int n, ...)
+{
+    R_xlen_t nsm = 0;
+    va_list arguments;
+
+    va_start(arguments, n);
+    for (R_len_t i = 0; i < n; ++i) {
+        R_xlen_t curlen = va_arg(arguments, R_xlen_t);
+        if (curlen <= 0) {
+            va_end(arguments);
+            return 0;
+        }
+        if (curlen > nsm)
+            nsm = curlen;
+    }
+    va_end(arguments);
+
+    if (enableWarning) {
+        va_start(arguments, n);
+        for (R_len_t i = 0; i < n; ++i) {
+            R_xlen_t curlen = va_arg(arguments, R_xlen_t);
+            if (nsm % curlen != 0) {
+                Rf_warning(MSG__WARN_RECYCLING_RULE);
+                break;
+            }
+        }
+        va_end(arguments);
+    }
+
+    return nsm;
+}
+
+
 /**
  *  Creates a character vector filled with NA_character_
  *
@@ -174,7 +221,7 @@ R_len_t stri__recycling_rule(bool enableWarning, int n, ...)
  *
  * @version 0.1-?? (Marek Gagolewski)
 */
-SEXP stri__vector_NA_strings(R_len_t howmany)
+SEXP stri__vector_NA_strings(R_xlen_t howmany)
 {
     if (howmany < 0) {
         Rf_warning(MSG__EXPECTED_NONNEGATIVE);
@@ -183,7 +230,7 @@ SEXP stri__vector_NA_strings(R_len_t howmany)
 
     SEXP ret;
     PROTECT(ret = Rf_allocVector(STRSXP, howmany));
-    for (R_len_t i=0; i<howmany; ++i)
+    for (R_xlen_t i=0; i<howmany; ++i)
         SET_STRING_ELT(ret, i, NA_STRING);
     UNPROTECT(1);
 
@@ -199,7 +246,7 @@ SEXP stri__vector_NA_strings(R_len_t howmany)
  *
  * @version 0.1-?? (Marek Gagolewski)
 */
-SEXP stri__vector_NA_integers(R_len_t howmany)
+SEXP stri__vector_NA_integers(R_xlen_t howmany)
 {
     if (howmany < 0) {
         Rf_warning(MSG__EXPECTED_NONNEGATIVE);
@@ -208,7 +255,7 @@ SEXP stri__vector_NA_integers(R_len_t howmany)
 
     SEXP ret;
     PROTECT(ret = Rf_allocVector(INTSXP, howmany));
-    for (R_len_t i=0; i<howmany; ++i)
+    for (R_xlen_t i=0; i<howmany; ++i)
         INTEGER(ret)[i] = NA_INTEGER;
     UNPROTECT(1);
 
@@ -224,7 +271,7 @@ SEXP stri__vector_NA_integers(R_len_t howmany)
  *
  * @version 0.1-?? (Marek Gagolewski)
 */
-SEXP stri__vector_empty_strings(R_len_t howmany)
+SEXP stri__vector_empty_strings(R_xlen_t howmany)
 {
     if (howmany < 0) {
         Rf_warning(MSG__EXPECTED_NONNEGATIVE);
@@ -233,7 +280,7 @@ SEXP stri__vector_empty_strings(R_len_t howmany)
 
     SEXP ret;
     PROTECT(ret = Rf_allocVector(STRSXP, howmany));
-    for (R_len_t i=0; i<howmany; ++i)
+    for (R_xlen_t i=0; i<howmany; ++i)
         SET_STRING_ELT(ret, i, R_BlankString);
     UNPROTECT(1);
 
@@ -33,6 +33,8 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_utf16.h"
+#include "stri_container_listraw.h"
+#include "stri_packed.h"
 #include <unicode/ucol.h>
 #include <vector>
 #include <deque>
@@ -92,6 +94,72 @@
    ************************************************************************* */
 
 
+/** Byte-wise comparison, where at least one argument is a packed raw vector
+ *
+ * Packed vectors are read in place, see \code{StriPackedRaw};
+ * the other argument may be a character vector (converted to UTF-8)
+ * or a list of raw vectors.
+ *
+ * @param e1 packed raw vector, list of raw vectors, or character vector
+ * @param e2 packed raw vector, list of raw vectors, or character vector
+ * @param _negate single bool
+ * @return logical vector
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static SEXP stri__cmp_codepoints_packed(SEXP e1, SEXP e2, int _negate)
+{
+    PROTECT(e1 = stri__prepare_arg_list_raw(e1, "e1"));
+    PROTECT(e2 = stri__prepare_arg_list_raw(e2, "e2"));
+
+    // character vectors are compared in UTF-8, as in stri_cmp_codepoints
+    if (Rf_isString(e1))
+        PROTECT(e1 = stri_enc_toutf8(e1, Rf_ScalarLogical(FALSE), Rf_ScalarLogical(FALSE)));
+    else
+        PROTECT(e1);
+    if (Rf_isString(e2))
+        PROTECT(e2 = stri_enc_toutf8(e2, Rf_ScalarLogical(FALSE), Rf_ScalarLogical(FALSE)));
+    else
+        PROTECT(e2);
+
+    STRI__ERROR_HANDLER_BEGIN(4)
+
+    StriContainerListRaw e1_cont(e1);
+    StriContainerListRaw e2_cont(e2);
+
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2,
+        e1_cont.get_n(), e2_cont.get_n());
+    e1_cont.set_nrecycle(vectorize_length);
+    e2_cont.set_nrecycle(vectorize_length);
+
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
+    int* ret_tab = LOGICAL(ret);
+
+    for (R_xlen_t i = 0; i < vectorize_length; ++i)
+    {
+        if (e1_cont.isNA(i) || e2_cont.isNA(i)) {
+            ret_tab[i] = NA_LOGICAL;
+            continue;
+        }
+
+        const String8& cur1 = e1_cont.get(i);
+        const String8& cur2 = e2_cont.get(i);
+
+        ret_tab[i] = (cur1.length() == cur2.length() &&
+            memcmp(cur1.c_str(), cur2.c_str(), cur1.length()) == 0);
+
+        if (_negate)
+            ret_tab[i] = !ret_tab[i];
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+
+    STRI__ERROR_HANDLER_END({/* no-op on err */})
+}
+
+
 /**
  * Compare elements in 2 character vectors, without collation [INTERNAL]
  *
@@ -112,6 +180,9 @@ SEXP stri_cmp_codepoints(SEXP e1, SEXP e2, int _negate)
     if (_negate < 0 || _negate > 1)
         Rf_error(MSG__INCORRECT_INTERNAL_ARG);
 
+    if (StriPackedRaw::isPacked(e1) || StriPackedRaw::isPacked(e2))
+        return stri__cmp_codepoints_packed(e1, e2, _negate);
+
     PROTECT(e1 = stri__prepare_arg_string(e1, "e1")); // prepare string argument
     PROTECT(e2 = stri__prepare_arg_string(e2, "e2")); // prepare string argument
 
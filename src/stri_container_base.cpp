@@ -53,7 +53,7 @@ StriContainerBase::StriContainerBase()
  * Initialize object data
  *
  */
-void StriContainerBase::init_Base(R_len_t _n, R_len_t _nrecycle, bool _shallowrecycle, SEXP _sexp)
+void StriContainerBase::init_Base(R_xlen_t _n, R_xlen_t _nrecycle, bool _shallowrecycle, SEXP _sexp)
 {
 #ifndef NDEBUG
     if (this->n != 0 || this->nrecycle != 0 || this->sexp != (SEXP)NULL)
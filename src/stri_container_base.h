@@ -51,13 +51,16 @@
  *
  * @version 0.2-1 (Marek Gagolewski, 2014-03-22)
  *          added sexp field
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          n and nrecycle are now R_xlen_t (long vector support)
  */
 class StriContainerBase {
 
 protected:
 
-    R_len_t n;                 ///< number of strings (size of \code{str})
-    R_len_t nrecycle;          ///< number of strings for the recycle rule (can be > \code{n})
+    R_xlen_t n;                ///< number of strings (size of \code{str})
+    R_xlen_t nrecycle;         ///< number of strings for the recycle rule (can be > \code{n})
     SEXP sexp;                 ///<
 
 #ifndef NDEBUG
@@ -68,36 +71,36 @@ protected:
     // StriContainerBase(StriContainerBase& container); // use default (shallow copy)
     //~StriContainerBase(); // use default
 
-    void init_Base(R_len_t n, R_len_t nrecycle, bool shallowrecycle, SEXP sexp=NULL);
+    void init_Base(R_xlen_t n, R_xlen_t nrecycle, bool shallowrecycle, SEXP sexp=NULL);
 
 
 public:
     //StriContainerBase& operator=(StriContainerBase& container); // use default (shallow)
 
-    inline R_len_t get_n() {
+    inline R_xlen_t get_n() {
         return n;
     }
-    inline R_len_t get_nrecycle() {
+    inline R_xlen_t get_nrecycle() {
         return nrecycle;
     }
-    inline void set_nrecycle(R_len_t nval) {
+    inline void set_nrecycle(R_xlen_t nval) {
         nrecycle = nval;
     }
 
 
     /** Loop over vectorized container - init */
-    inline R_len_t vectorize_init() const {
+    inline R_xlen_t vectorize_init() const {
         if (n <= 0) return nrecycle;
         else return 0;
     }
 
     /** Loop over vectorized container - end iterator */
-    inline R_len_t vectorize_end() const {
+    inline R_xlen_t vectorize_end() const {
         return nrecycle;
     }
 
     /** Loop over vectorized container - next iteration */
-    inline R_len_t vectorize_next(R_len_t i) const {
+    inline R_xlen_t vectorize_next(R_xlen_t i) const {
         if (i == nrecycle - 1 - (nrecycle%n))
             return nrecycle; // this is the end
         i = i + n;
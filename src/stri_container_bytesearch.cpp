@@ -52,14 +52,14 @@ StriContainerByteSearch::StriContainerByteSearch()
  * @param rstr R character vector
  * @param _nrecycle extend length [vectorization]
  */
-StriContainerByteSearch::StriContainerByteSearch(SEXP rstr, R_len_t _nrecycle, uint32_t _flags)
+StriContainerByteSearch::StriContainerByteSearch(SEXP rstr, R_xlen_t _nrecycle, uint32_t _flags)
     : StriContainerUTF8(rstr, _nrecycle, true)
 {
     this->flags = _flags;
     this->matcher = NULL;
 
-    R_len_t n = get_n();
-    for (R_len_t i=0; i<n; ++i) {
+    R_xlen_t n = get_n();
+    for (R_xlen_t i=0; i<n; ++i) {
         if (!isNA(i) && get(i).length() <= 0) {
             Rf_warning(MSG__EMPTY_SEARCH_PATTERN_UNSUPPORTED);
         }
@@ -105,7 +105,7 @@ StriContainerByteSearch::~StriContainerByteSearch()
 /**
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  */
-StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i) {
+StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_xlen_t i) {
     if (i >= n && matcher && matcher->getPatternStr() == get(i).c_str()) {
         // matcher reuse
     }
@@ -115,20 +115,74 @@ StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i) {
             matcher = NULL;
         }
 
-        if (isCaseInsensitive())
-            matcher = new StriByteSearchMatcherKMPci(get(i).c_str(), get(i).length(), isOverlap());
-        else if (get(i).length() == 1)
-            matcher = new StriByteSearchMatcher1(get(i).c_str(), get(i).length(), isOverlap());
-        else if (get(i).length() < 16)
-            matcher = new StriByteSearchMatcherShort(get(i).c_str(), get(i).length(), isOverlap());
-        else
-            matcher = new StriByteSearchMatcherKMP(get(i).c_str(), get(i).length(), isOverlap());
+        matcher = newMatcher(i);
     }
 
     return matcher;
 }
 
 
+/** Get a matcher for the i-th pattern, reusing a cached one if possible
+ *
+ * Thread-safe version of getMatcher(); each thread should have
+ * its own \code{cache}, see StriParallel.
+ *
+ * @param i index
+ * @param cache matcher for the previously used pattern or empty
+ * @return \code{cache.get()}
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_xlen_t i,
+    std::unique_ptr<StriByteSearchMatcher>& cache) const
+{
+    if (!cache || cache->getPatternStr() != get(i).c_str())
+        cache.reset(newMatcher(i));
+    return cache.get();
+}
+
+
+/** Create a new matcher for the i-th pattern
+ *
+ * Unlike getMatcher(), this does not modify the container,
+ * so it can be used by many threads at the same time,
+ * see StriParallel.
+ *
+ * @param i index
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriByteSearchMatcher* StriContainerByteSearch::newMatcher(R_xlen_t i) const {
+    return newMatcher(get(i).c_str(), get(i).length(), isCaseInsensitive(), isOverlap());
+}
+
+
+/** Create a new matcher for a given pattern
+ *
+ * @param patternStr non-empty pattern in UTF-8, not copied
+ *     (must outlive the matcher)
+ * @param patternLen number of bytes in patternStr
+ * @param caseInsensitive
+ * @param overlap
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriByteSearchMatcher* StriContainerByteSearch::newMatcher(const char* patternStr,
+    R_len_t patternLen, bool caseInsensitive, bool overlap)
+{
+    if (caseInsensitive)
+        return new StriByteSearchMatcherKMPci(patternStr, patternLen, overlap);
+    else if (patternLen == 1)
+        return new StriByteSearchMatcher1(patternStr, patternLen, overlap);
+    else if (patternLen < 16)
+        return new StriByteSearchMatcherShort(patternStr, patternLen, overlap);
+    else
+        return new StriByteSearchMatcherKMP(patternStr, patternLen, overlap);
+}
+
+
 /** find first match - case of short pattern
  *
  * @param startPos where to start
@@ -35,6 +35,7 @@
 
 #include "stri_container_utf8.h"
 #include "stri_bytesearch_matcher.h"
+#include <memory>
 
 // #define STRI__BYTESEARCH_DISABLE_SHORTPAT
 
@@ -86,18 +87,22 @@ public:
     static uint32_t getByteSearchFlags(SEXP opts_fixed, bool allow_overlap=false);
 
     StriContainerByteSearch();
-    StriContainerByteSearch(SEXP rstr, R_len_t nrecycle, uint32_t flags);
+    StriContainerByteSearch(SEXP rstr, R_xlen_t nrecycle, uint32_t flags);
     StriContainerByteSearch(StriContainerByteSearch& container);
     ~StriContainerByteSearch();
     StriContainerByteSearch& operator=(StriContainerByteSearch& container);
 
-    StriByteSearchMatcher* getMatcher(R_len_t i);
+    StriByteSearchMatcher* getMatcher(R_xlen_t i);
+    StriByteSearchMatcher* newMatcher(R_xlen_t i) const;
+    static StriByteSearchMatcher* newMatcher(const char* patternStr, R_len_t patternLen,
+        bool caseInsensitive, bool overlap);
+    StriByteSearchMatcher* getMatcher(R_xlen_t i, std::unique_ptr<StriByteSearchMatcher>& cache) const;
 
-    inline bool isCaseInsensitive() {
+    inline bool isCaseInsensitive() const {
         return (bool)(flags&BYTESEARCH_CASE_INSENSITIVE);
     }
 
-    inline bool isOverlap() {
+    inline bool isOverlap() const {
         return (bool)(flags&BYTESEARCH_OVERLAP);
     }
 };
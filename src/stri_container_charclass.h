@@ -38,6 +38,10 @@
 #include <unicode/uniset.h>
 
 
+/** size of the ASCII lookup tables in StriContainerCharClass */
+#define STRI__CHARCLASS_ASCII_SIZE (ASCII_MAXCHARCODE+1)
+
+
 /**
  * A container handling charclass searches
  *
@@ -52,21 +56,43 @@
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-06-10)
  *          negate
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          ASCII lookup tables: getASCIITable
  */
 class StriContainerCharClass : public StriContainerBase {
 
 private:
 
     UnicodeSet* data; // array
+    bool* ascii;      // array of n*STRI__CHARCLASS_ASCII_SIZE: data[i].contains(c) for c in ASCII
+
+
+    /** precompute the ASCII lookup tables */
+    void initASCII()
+    {
+        if (!data) {
+            ascii = NULL;
+            return;
+        }
+        ascii = new bool[n*STRI__CHARCLASS_ASCII_SIZE];
+        for (R_xlen_t i=0; i<n; ++i) {
+            bool* ascii_cur = ascii+i*STRI__CHARCLASS_ASCII_SIZE;
+            for (UChar32 c=0; c<STRI__CHARCLASS_ASCII_SIZE; ++c)
+                ascii_cur[c] = !data[i].isBogus() && data[i].contains(c);
+        }
+    }
+
 
 public:
 
     StriContainerCharClass() : StriContainerBase()
     {
         data = NULL;
+        ascii = NULL;
     }
 
-    StriContainerCharClass(SEXP rvec, R_len_t _nrecycle, bool negate=false)
+    StriContainerCharClass(SEXP rvec, R_xlen_t _nrecycle, bool negate=false)
     {
 #ifndef NDEBUG
         if (!Rf_isString(rvec))
@@ -95,6 +121,7 @@ public:
                 }
             }
         }
+        initASCII();
     }
 
     StriContainerCharClass(StriContainerCharClass& container)
@@ -102,15 +129,19 @@ public:
     {
         if (container.data) {
             this->data = new UnicodeSet[container.n];
-            for (int i=0; i<container.n; ++i)
+            for (R_xlen_t i=0; i<container.n; ++i)
                 this->data[i] = container.data[i];
         }
         else
             this->data = NULL;
+        initASCII();
     }
 
     ~StriContainerCharClass() {
         if (data) delete [] data;
+        if (ascii) delete [] ascii;
+        data = NULL;
+        ascii = NULL;
     }
 
     StriContainerCharClass& operator=(StriContainerCharClass& container)
@@ -119,11 +150,12 @@ public:
         (StriContainerBase&) (*this) = (StriContainerBase&)container;
         if (container.data) {
             this->data = new UnicodeSet[container.n];
-            for (int i=0; i<container.n; ++i)
+            for (R_xlen_t i=0; i<container.n; ++i)
                 this->data[i] = container.data[i];
         }
         else
             this->data = NULL;
+        initASCII();
         return *this;
     }
 
@@ -132,7 +164,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerCharClass::isNA(): INDEX OUT OF BOUNDS");
@@ -145,7 +177,7 @@ public:
      * @param i index
      * @return integer
      */
-    inline const UnicodeSet& get(R_len_t i) const {
+    inline const UnicodeSet& get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerCharClass::get(): INDEX OUT OF BOUNDS");
@@ -156,17 +188,56 @@ public:
     }
 
 
+    /** get the ASCII lookup table for the vectorized ith element
+     *
+     * @param i index
+     * @return array of size STRI__CHARCLASS_ASCII_SIZE;
+     *    the c-th element is true iff the charclass contains \code{c}
+     *
+     * @version 1.8.8 (2026-10-19)
+     */
+    inline const bool* getASCIITable(R_xlen_t i) const {
+#ifndef NDEBUG
+        if (i < 0 || i >= nrecycle)
+            throw StriException("StriContainerCharClass::getASCIITable(): INDEX OUT OF BOUNDS");
+#endif
+        return ascii+(i%n)*STRI__CHARCLASS_ASCII_SIZE;
+    }
+
+
     /** Locate all occurrences of a charclass
+     *
+     * @param ascii_cur if not NULL, \code{str_cur_s} is in ASCII and
+     * this is the corresponding table from \code{getASCIITable}
      *
      * @return total number of bytes @ pattern matches (idx_codepoint==false)
      * or total number of codepoints matched (idx_codepoint==true)
+     *
+     * @version 1.8.8 (2026-10-19)
+     *          ASCII fast path
      */
     static R_len_t locateAll(deque< pair<R_len_t, R_len_t> >& occurrences,
                              const UnicodeSet* pattern_cur,
                              const char* str_cur_s, R_len_t str_cur_n,
-                             bool merge_cur, bool idx_codepoint)
+                             bool merge_cur, bool idx_codepoint,
+                             const bool* ascii_cur=NULL)
     {
-        if (idx_codepoint) {
+        if (ascii_cur) {
+            // one byte == one code point
+            R_len_t sumchars = 0;
+            for (R_len_t j=0; j<str_cur_n; ++j) {
+                if (ascii_cur[(unsigned char)str_cur_s[j]]) {
+                    if (merge_cur && occurrences.size() > 0 &&
+                            occurrences.back().second == j)
+                        occurrences.back().second = j+1;
+                    else
+                        occurrences.push_back(pair<R_len_t, R_len_t>(j, j+1));
+                    ++sumchars;
+                }
+            }
+            return sumchars;
+        }
+        else if (idx_codepoint) {
             R_len_t j, k;
             UChar32 chr;
             R_len_t sumcodepoints = 0;
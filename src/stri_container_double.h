@@ -54,14 +54,14 @@ public:
         data = NULL;
     }
 
-    StriContainerDouble(SEXP rvec, R_len_t _nrecycle)
+    StriContainerDouble(SEXP rvec, R_xlen_t _nrecycle)
     {
         this->data = NULL;
 #ifndef NDEBUG
         if (!Rf_isReal(rvec))
             throw StriException("DEBUG: !Rf_isReal in StriContainerDouble");
 #endif
-        R_len_t ndata = LENGTH(rvec);
+        R_xlen_t ndata = XLENGTH(rvec);
         this->init_Base(ndata, _nrecycle, true);
         this->data = REAL(rvec);  // TODO: ALTREP will be problematic?
     }
@@ -75,7 +75,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerDouble::isNA(): INDEX OUT OF BOUNDS");
@@ -89,7 +89,7 @@ public:
      * @param i index
      * @return double
      */
-    inline double get(R_len_t i) const {
+    inline double get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerDouble::get(): INDEX OUT OF BOUNDS");
@@ -105,7 +105,7 @@ public:
      * @param i index
      * @return double
      */
-    inline double getNAble(R_len_t i) const {
+    inline double getNAble(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerDouble::get(): INDEX OUT OF BOUNDS");
@@ -54,14 +54,14 @@ public:
         data = NULL;
     }
 
-    StriContainerInteger(SEXP rvec, R_len_t _nrecycle)
+    StriContainerInteger(SEXP rvec, R_xlen_t _nrecycle)
     {
         this->data = NULL;
 #ifndef NDEBUG
         if (!Rf_isInteger(rvec))
             throw StriException("DEBUG: !isInteger in StriContainerInteger");
 #endif
-        R_len_t ndata = LENGTH(rvec);
+        R_xlen_t ndata = XLENGTH(rvec);
         this->init_Base(ndata, _nrecycle, true);
         this->data = INTEGER(rvec);  // TODO: ALTREP will be problematic?
     }
@@ -75,7 +75,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerInteger::isNA(): INDEX OUT OF BOUNDS");
@@ -89,7 +89,7 @@ public:
      * @param i index
      * @return integer
      */
-    inline int get(R_len_t i) const {
+    inline int get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerInteger::get(): INDEX OUT OF BOUNDS");
@@ -105,7 +105,7 @@ public:
      * @param i index
      * @return integer
      */
-    inline int getNAble(R_len_t i) const {
+    inline int getNAble(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerInteger::get(): INDEX OUT OF BOUNDS");
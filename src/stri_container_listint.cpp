@@ -68,11 +68,11 @@ StriContainerListInt::StriContainerListInt(SEXP rstr)
     }
     else // if (Rf_isVectorList(rstr)) -- args already checked
     {
-        R_len_t nv = LENGTH(rstr);
+        R_xlen_t nv = XLENGTH(rstr);
         this->init_Base(nv, nv, true);
         this->data = new IntVec[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (R_len_t i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             SEXP cur = VECTOR_ELT(rstr, i);
             if (!Rf_isNull(cur))
                 this->data[i].initialize((const int*)INTEGER(cur), LENGTH(cur)); // shallow copy // TODO: ALTREP will be problematic?
@@ -88,7 +88,7 @@ StriContainerListInt::StriContainerListInt(StriContainerListInt& container)
     if (container.data) {
         this->data = new IntVec[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->data[i] = container.data[i];
         }
     }
@@ -106,7 +106,7 @@ StriContainerListInt& StriContainerListInt::operator=(StriContainerListInt& cont
     if (container.data) {
         this->data = new IntVec[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->data[i] = container.data[i];
         }
     }
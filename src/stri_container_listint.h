@@ -65,7 +65,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerListInt::isNA(): INDEX OUT OF BOUNDS");
@@ -78,7 +78,7 @@ public:
      * @param i index
      * @return string, read only
      */
-    const IntVec& get(R_len_t i) const {
+    const IntVec& get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerListInt::get(): INDEX OUT OF BOUNDS");
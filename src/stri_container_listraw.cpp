@@ -32,6 +32,7 @@
 
 #include "stri_stringi.h"
 #include "stri_container_listraw.h"
+#include "stri_packed.h"
 
 
 /**
@@ -53,12 +54,42 @@ StriContainerListRaw::StriContainerListRaw()
  *
  * @version 1.6.2 (Marek Gagolewski, 2021-05-14)
  *    #354 Force the copying of ALTREP data
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    packed raw vectors (checked by stri__prepare_arg_list_raw)
  */
 StriContainerListRaw::StriContainerListRaw(SEXP rstr)
 {
     this->data = NULL;
 
-    if (Rf_isNull(rstr)) {
+    if (StriPackedRaw::isPacked(rstr)) {
+        SEXP rdata    = VECTOR_ELT(rstr, 0);
+        SEXP roffsets = VECTOR_ELT(rstr, 1);
+        SEXP rna      = VECTOR_ELT(rstr, 2);
+        R_xlen_t nv = XLENGTH(rna);
+        this->init_Base(nv, nv, true);
+        if (this->n == 0) return;
+        this->data = new String8[this->n];
+        if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
+        bool memalloc = ALTREP(rdata);  // #354: force copying of ALTREP data
+        const char* rdata_s = (const char*)RAW(rdata);
+        const int* rna_tab = LOGICAL(rna);
+        for (R_xlen_t i=0; i<this->n; ++i) {
+            if (rna_tab[i] != FALSE) continue;  // leave as-is, i.e., NA
+            R_xlen_t from, to;
+            if (TYPEOF(roffsets) == INTSXP) {
+                from = INTEGER(roffsets)[i];
+                to   = INTEGER(roffsets)[i+1];
+            }
+            else {
+                from = (R_xlen_t)REAL(roffsets)[i];
+                to   = (R_xlen_t)REAL(roffsets)[i+1];
+            }
+            this->data[i].initialize(rdata_s+from, (R_len_t)(to-from),
+                                     memalloc, false/*killbom*/, false/*isASCII*/); // shallow copy
+        }
+    }
+    else if (Rf_isNull(rstr)) {
         this->init_Base(1, 1, true);
         this->data = new String8[this->n]; // 1 string, NA
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
@@ -72,11 +103,11 @@ StriContainerListRaw::StriContainerListRaw(SEXP rstr)
                                  memalloc, false/*killbom*/, false/*isASCII*/); // shallow copy
     }
     else if (Rf_isVectorList(rstr)) {
-        R_len_t nv = LENGTH(rstr);
+        R_xlen_t nv = XLENGTH(rstr);
         this->init_Base(nv, nv, true);
         this->data = new String8[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (R_len_t i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             SEXP cur = VECTOR_ELT(rstr, i);
             if (!Rf_isNull(cur)) {
                 bool memalloc = ALTREP(cur);  // #354: force copying of ALTREP data
@@ -87,11 +118,11 @@ StriContainerListRaw::StriContainerListRaw(SEXP rstr)
         }
     }
     else { // it's surely a character vector (args have been checked)
-        R_len_t nv = LENGTH(rstr);
+        R_xlen_t nv = XLENGTH(rstr);
         this->init_Base(nv, nv, true);
         this->data = new String8[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (R_len_t i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             SEXP cur = STRING_ELT(rstr, i);
             if (cur != NA_STRING) {
                 bool memalloc = ALTREP(rstr);  // #354: force copying of ALTREP data
@@ -110,7 +141,7 @@ StriContainerListRaw::StriContainerListRaw(StriContainerListRaw& container)
     if (container.data) {
         this->data = new String8[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->data[i] = container.data[i];
         }
     }
@@ -128,7 +159,7 @@ StriContainerListRaw& StriContainerListRaw::operator=(StriContainerListRaw& cont
     if (container.data) {
         this->data = new String8[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->data[i] = container.data[i];
         }
     }
@@ -69,7 +69,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerListRaw::isNA(): INDEX OUT OF BOUNDS");
@@ -82,7 +82,7 @@ public:
      * @param i index
      * @return string, read only
      */
-    const String8& get(R_len_t i) const {
+    const String8& get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerListRaw::get(): INDEX OUT OF BOUNDS");
@@ -51,23 +51,23 @@ StriContainerListUTF8::StriContainerListUTF8()
  * @param nrecycle extend length of each character vector stored [vectorization]
  * @param shallowrecycle will stored character vectors be ever modified?
  */
-StriContainerListUTF8::StriContainerListUTF8(SEXP rvec, R_len_t _nrecycle, bool _shallowrecycle)
+StriContainerListUTF8::StriContainerListUTF8(SEXP rvec, R_xlen_t _nrecycle, bool _shallowrecycle)
 {
     this->data = NULL;
 #ifndef NDEBUG
     if (!Rf_isVectorList(rvec))
         throw StriException("DEBUG: !isVectorList in StriContainerListUTF8::StriContainerListUTF8(SEXP rvec)");
 #endif
-    R_len_t rvec_length = LENGTH(rvec);
+    R_xlen_t rvec_length = XLENGTH(rvec);
     this->init_Base(rvec_length, rvec_length, true);
 
     if (this->n > 0) {
         this->data = new StriContainerUTF8*[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (R_len_t i=0; i<this->n; ++i)
+        for (R_xlen_t i=0; i<this->n; ++i)
             this->data[i] = NULL; // in case it fails during conversion (this is "NA")
 
-        for (R_len_t i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             R_len_t strlist_cur_length = LENGTH(VECTOR_ELT(rvec, i));
             if (_nrecycle % strlist_cur_length != 0) {
                 Rf_warning(MSG__WARN_RECYCLING_RULE);
@@ -75,7 +75,7 @@ StriContainerListUTF8::StriContainerListUTF8(SEXP rvec, R_len_t _nrecycle, bool
             }
         }
 
-        for (R_len_t i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->data[i] = new StriContainerUTF8(VECTOR_ELT(rvec, i), _nrecycle, _shallowrecycle);
             if (!this->data[i]) throw StriException(MSG__MEM_ALLOC_ERROR);
         }
@@ -89,7 +89,7 @@ StriContainerListUTF8::StriContainerListUTF8(StriContainerListUTF8& container)
     if (container.data) {
         this->data = new StriContainerUTF8*[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (int i=0; i<container.n; ++i) {
+        for (R_xlen_t i=0; i<container.n; ++i) {
             if (container.data[i]) {
                 this->data[i] = new StriContainerUTF8(*container.data[i]);
                 if (!this->data[i]) throw StriException(MSG__MEM_ALLOC_ERROR);
@@ -112,7 +112,7 @@ StriContainerListUTF8& StriContainerListUTF8::operator=(StriContainerListUTF8& c
     if (container.data) {
         this->data = new StriContainerUTF8*[this->n];
         if (!this->data) throw StriException(MSG__MEM_ALLOC_ERROR);
-        for (int i=0; i<container.n; ++i) {
+        for (R_xlen_t i=0; i<container.n; ++i) {
             if (container.data[i]) {
                 this->data[i] = new StriContainerUTF8(*container.data[i]);
                 if (!this->data[i]) throw StriException(MSG__MEM_ALLOC_ERROR);
@@ -132,7 +132,7 @@ StriContainerListUTF8& StriContainerListUTF8::operator=(StriContainerListUTF8& c
 StriContainerListUTF8::~StriContainerListUTF8()
 {
     if (data) {
-        for (int i=0; i<n; ++i) {
+        for (R_xlen_t i=0; i<n; ++i) {
             if (data[i])
                 delete data[i];
         }
@@ -54,11 +54,11 @@ private:
 public:
 
     StriContainerListUTF8();
-    StriContainerListUTF8(SEXP rlist, R_len_t nrecycle, bool shallowrecycle=true);
+    StriContainerListUTF8(SEXP rlist, R_xlen_t nrecycle, bool shallowrecycle=true);
     StriContainerListUTF8(StriContainerListUTF8& container);
     ~StriContainerListUTF8();
     StriContainerListUTF8& operator=(StriContainerListUTF8& container);
-    SEXP toR(R_len_t i) const;
+    SEXP toR(R_xlen_t i) const;
     SEXP toR() const;
 
 
@@ -66,7 +66,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerListUTF8::isNA(): INDEX OUT OF BOUNDS");
@@ -79,7 +79,7 @@ public:
      * @param i index
      * @return string, read only
      */
-    const StriContainerUTF8& get(R_len_t i) const {
+    const StriContainerUTF8& get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerListUTF8::get(): INDEX OUT OF BOUNDS");
@@ -55,14 +55,14 @@ public:
         data = NULL;
     }
 
-    StriContainerLogical(SEXP rvec, R_len_t _nrecycle)
+    StriContainerLogical(SEXP rvec, R_xlen_t _nrecycle)
     {
         this->data = NULL;
 #ifndef NDEBUG
         if (!Rf_isLogical(rvec))
             throw StriException("DEBUG: !Rf_isLogical in StriContainerLogical");
 #endif
-        R_len_t ndata = LENGTH(rvec);
+        R_xlen_t ndata = XLENGTH(rvec);
         this->init_Base(ndata, _nrecycle, true);
         this->data = LOGICAL(rvec);  // TODO: ALTREP will be problematic?
     }
@@ -76,7 +76,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerLogical::isNA(): INDEX OUT OF BOUNDS");
@@ -89,7 +89,7 @@ public:
      * @param i index
      * @return integer
      */
-    inline int get(R_len_t i) const {
+    inline int get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerLogical::get(): INDEX OUT OF BOUNDS");
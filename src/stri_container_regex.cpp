@@ -55,7 +55,7 @@ StriContainerRegexPattern::StriContainerRegexPattern()
  * @param nrecycle extend length [vectorization]
  * @param flags regexp flags
  */
-StriContainerRegexPattern::StriContainerRegexPattern(SEXP rstr, R_len_t _nrecycle, StriRegexMatcherOptions _opts)
+StriContainerRegexPattern::StriContainerRegexPattern(SEXP rstr, R_xlen_t _nrecycle, StriRegexMatcherOptions _opts)
     : StriContainerUTF16(rstr, _nrecycle, true)
 {
     this->lastMatcherIndex = -1;
@@ -64,8 +64,8 @@ StriContainerRegexPattern::StriContainerRegexPattern(SEXP rstr, R_len_t _nrecycl
     //this->lastCaptureGroupNames = ...
     this->opts = _opts;
 
-    R_len_t n = get_n();
-    for (R_len_t i=0; i<n; ++i) {
+    R_xlen_t n = get_n();
+    for (R_xlen_t i=0; i<n; ++i) {
         if (!isNA(i) && get(i).length() <= 0) {
             Rf_warning(MSG__EMPTY_SEARCH_PATTERN_UNSUPPORTED);
         }
@@ -123,7 +123,7 @@ StriContainerRegexPattern::~StriContainerRegexPattern()
  * @version 1.7.1 (Marek Gagolewski, 2021-06-20)  #153
  */
 SEXP StriContainerRegexPattern::getCaptureGroupRNames(
-    R_len_t i  // TODO allow reuse
+    R_xlen_t i  // TODO allow reuse
 ) {
     // TODO - refactor - too similar to getCaptureGroupRDimnames
 
@@ -166,7 +166,7 @@ SEXP StriContainerRegexPattern::getCaptureGroupRNames(
  * @version 1.7.1 (Marek Gagolewski, 2021-06-20)  #153
  */
 SEXP StriContainerRegexPattern::getCaptureGroupRDimnames(
-    R_len_t i, R_len_t last_i, SEXP ret
+    R_xlen_t i, R_xlen_t last_i, SEXP ret
 ) {
     // TODO - refactor - too similar to getCaptureGroupRNames
 
@@ -226,7 +226,7 @@ SEXP StriContainerRegexPattern::getCaptureGroupRDimnames(
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-19)  #153
  */
-const std::vector<std::string>& StriContainerRegexPattern::getCaptureGroupNames(R_len_t i)
+const std::vector<std::string>& StriContainerRegexPattern::getCaptureGroupNames(R_xlen_t i)
 {
     STRI_ASSERT(lastMatcherIndex >= 0 && lastMatcherIndex == (i % n));
     STRI_ASSERT(lastMatcher);
@@ -336,7 +336,7 @@ const std::vector<std::string>& StriContainerRegexPattern::getCaptureGroupNames(
  *
  * @param i index
  */
-RegexMatcher* StriContainerRegexPattern::getMatcher(R_len_t i)
+RegexMatcher* StriContainerRegexPattern::getMatcher(R_xlen_t i)
 {
     if (lastMatcher) {
         if (this->lastMatcherIndex >= 0 && this->lastMatcherIndex == (i % n)) {
@@ -76,25 +76,25 @@ private:
 
     StriRegexMatcherOptions opts; ///< RegexMatcher options
     RegexMatcher* lastMatcher; ///< recently used RegexMatcher
-    R_len_t lastMatcherIndex;  ///< used by vectorize_getMatcher
+    R_xlen_t lastMatcherIndex;  ///< used by vectorize_getMatcher
 
     std::vector<std::string> lastCaptureGroupNames;
-    R_len_t lastCaptureGroupNamesIndex;
+    R_xlen_t lastCaptureGroupNamesIndex;
 
 public:
 
     static StriRegexMatcherOptions getRegexOptions(SEXP opts_regex);
 
     StriContainerRegexPattern();
-    StriContainerRegexPattern(SEXP rstr, R_len_t nrecycle, StriRegexMatcherOptions opts);
+    StriContainerRegexPattern(SEXP rstr, R_xlen_t nrecycle, StriRegexMatcherOptions opts);
     StriContainerRegexPattern(StriContainerRegexPattern& container);
     ~StriContainerRegexPattern();
     StriContainerRegexPattern& operator=(StriContainerRegexPattern& container);
-    RegexMatcher* getMatcher(R_len_t i);
-    const std::vector<std::string>& getCaptureGroupNames(R_len_t i);
+    RegexMatcher* getMatcher(R_xlen_t i);
+    const std::vector<std::string>& getCaptureGroupNames(R_xlen_t i);
 
-    SEXP getCaptureGroupRDimnames(R_len_t i, R_len_t last_i=-1, SEXP ret=R_NilValue);
-    SEXP getCaptureGroupRNames(R_len_t i);  // TODO: allow reuse
+    SEXP getCaptureGroupRDimnames(R_xlen_t i, R_xlen_t last_i=-1, SEXP ret=R_NilValue);
+    SEXP getCaptureGroupRNames(R_xlen_t i);  // TODO: allow reuse
 };
 
 #endif
@@ -53,15 +53,15 @@ StriContainerUStringSearch::StriContainerUStringSearch()
  * @param nrecycle extend length [vectorization]
  * @param col Collator; owned by external caller
  */
-StriContainerUStringSearch::StriContainerUStringSearch(SEXP rstr, R_len_t _nrecycle, UCollator* _col)
+StriContainerUStringSearch::StriContainerUStringSearch(SEXP rstr, R_xlen_t _nrecycle, UCollator* _col)
     : StriContainerUTF16(rstr, _nrecycle, true)
 {
     this->lastMatcherIndex = -1;
     this->lastMatcher = NULL;
     this->col = _col;
 
-    R_len_t n = get_n();
-    for (R_len_t i=0; i<n; ++i) {
+    R_xlen_t n = get_n();
+    for (R_xlen_t i=0; i<n; ++i) {
         if (!isNA(i) && get(i).length() <= 0) {
             Rf_warning(MSG__EMPTY_SEARCH_PATTERN_UNSUPPORTED);
         }
@@ -115,7 +115,7 @@ StriContainerUStringSearch::~StriContainerUStringSearch()
  * @param i index
  * @param searchStr string to search in
  */
-UStringSearch* StriContainerUStringSearch::getMatcher(R_len_t i, const UnicodeString& searchStr)
+UStringSearch* StriContainerUStringSearch::getMatcher(R_xlen_t i, const UnicodeString& searchStr)
 {
     return getMatcher(i, searchStr.getBuffer(), searchStr.length());
 }
@@ -131,7 +131,7 @@ UStringSearch* StriContainerUStringSearch::getMatcher(R_len_t i, const UnicodeSt
  * @param searchStr string to search in
  * @param searchStr_len string length in UChars
  */
-UStringSearch* StriContainerUStringSearch::getMatcher(R_len_t i, const UChar* searchStr, int32_t searchStr_len)
+UStringSearch* StriContainerUStringSearch::getMatcher(R_xlen_t i, const UChar* searchStr, int32_t searchStr_len)
 {
     if (!lastMatcher) {
         this->lastMatcherIndex = (i % n);
@@ -62,18 +62,18 @@ private:
 
     UCollator* col; ///< collator, owned by creator
     UStringSearch* lastMatcher; ///< recently used UStringSearch
-    R_len_t lastMatcherIndex;  ///< used by vectorize_getMatcher
+    R_xlen_t lastMatcherIndex;  ///< used by vectorize_getMatcher
 
 
 public:
 
     StriContainerUStringSearch();
-    StriContainerUStringSearch(SEXP rstr, R_len_t nrecycle, UCollator* col);
+    StriContainerUStringSearch(SEXP rstr, R_xlen_t nrecycle, UCollator* col);
     StriContainerUStringSearch(StriContainerUStringSearch& container);
     ~StriContainerUStringSearch();
     StriContainerUStringSearch& operator=(StriContainerUStringSearch& container);
-    UStringSearch* getMatcher(R_len_t i, const UnicodeString& searchStr);
-    UStringSearch* getMatcher(R_len_t i, const UChar* searchStr, int32_t searchStr_len);
+    UStringSearch* getMatcher(R_xlen_t i, const UnicodeString& searchStr);
+    UStringSearch* getMatcher(R_xlen_t i, const UChar* searchStr, int32_t searchStr_len);
 };
 
 #endif
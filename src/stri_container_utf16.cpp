@@ -53,7 +53,7 @@ StriContainerUTF16::StriContainerUTF16()
  *
  * @param nrecycle number of strings
  */
-StriContainerUTF16::StriContainerUTF16(R_len_t _nrecycle)
+StriContainerUTF16::StriContainerUTF16(R_xlen_t _nrecycle)
 {
     this->str = NULL;
     this->init_Base(_nrecycle, _nrecycle, false);
@@ -66,6 +66,34 @@ StriContainerUTF16::StriContainerUTF16(R_len_t _nrecycle)
 }
 
 
+/**
+ * Convert a string in a single-byte encoding to UTF-16 using a lookup table
+ *
+ * @param str [out] target string
+ * @param s input string
+ * @param n number of bytes in s
+ * @param table see \code{StriUcnv::getSBCSTable}; may be NULL
+ * @return false if the string should be converted with ICU
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__container_utf16_from_sbcs(UnicodeString& str,
+    const char* s, R_len_t n, const UChar32* table)
+{
+    if (!table) return false;
+    str.remove();  // unset bogus (NA)
+    UChar* buf = str.getBuffer(n);
+    if (!buf) throw StriException(MSG__MEM_ALLOC_ERROR);
+    R_len_t k = stri__sbcs_to_utf16(s, n, table, buf);
+    str.releaseBuffer(k < 0 ? 0 : k);
+    if (k < 0) {
+        str.setToBogus();
+        return false;
+    }
+    return true;
+}
+
+
 /**
  * Construct String Container from an R character vector
  *
@@ -75,15 +103,18 @@ StriContainerUTF16::StriContainerUTF16(R_len_t _nrecycle)
  *
  * @version 1.0.6 (Marek Gagolewski, 2017-05-25)
  *    #270 latin-1 is windows-1252 on Windows
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    convert from single-byte encodings via a lookup table
  */
-StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shallowrecycle)
+StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_xlen_t _nrecycle, bool _shallowrecycle)
 {
     this->str = NULL;
 #ifndef NDEBUG
     if (!Rf_isString(rstr))
         throw StriException("DEBUG: !Rf_isString in StriContainerUTF16::StriContainerUTF16(SEXP rstr)");
 #endif
-    R_len_t nrstr = LENGTH(rstr);
+    R_xlen_t nrstr = XLENGTH(rstr);
     this->init_Base(nrstr, _nrecycle, _shallowrecycle); // calling LENGTH(rstr) fails on constructor call
 
     if (this->n == 0)
@@ -94,7 +125,7 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
     STRI_ASSERT(this->str);
     if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR_WITH_SIZE,
                                             this->n*sizeof(UnicodeString));
-    for (R_len_t i=0; i<this->n; ++i)
+    for (R_xlen_t i=0; i<this->n; ++i)
         this->str[i].setToBogus(); // in case it fails during conversion (this is NA)
 
     /* Important: ICU provides full internationalisation functionality
@@ -110,7 +141,7 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
 #endif
     StriUcnv ucnvNative(NULL);
 
-    for (R_len_t i=0; i<nrstr; ++i) {
+    for (R_xlen_t i=0; i<nrstr; ++i) {
         SEXP curs = STRING_ELT(rstr, i);
         if (curs == NA_STRING) {
             continue; // keep NA
@@ -154,6 +185,10 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
             this->str[i].setTo(UnicodeString::fromUTF8(CHAR(curs)));
         }
         else if (IS_LATIN1(curs)) {
+            if (stri__container_utf16_from_sbcs(this->str[i], CHAR(curs), LENGTH(curs),
+                    ucnvLatin1.getSBCSTable()))
+                continue;
+
             UConverter* ucnv = ucnvLatin1.getConverter();
             UErrorCode status = U_ZERO_ERROR;
             this->str[i].setTo(
@@ -170,7 +205,8 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
                 // UTF-8
                 this->str[i].setTo(UnicodeString::fromUTF8(CHAR(curs)));
             }
-            else {
+            else if (!stri__container_utf16_from_sbcs(this->str[i], CHAR(curs), LENGTH(curs),
+                    ucnvNative.getSBCSTable())) {
                 UConverter* ucnv = ucnvNative.getConverter();
                 UErrorCode status = U_ZERO_ERROR;
                 this->str[i].setTo(
@@ -182,7 +218,7 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
     }
 
     if (!_shallowrecycle) {
-        for (R_len_t i=nrstr; i<this->n; ++i) {
+        for (R_xlen_t i=nrstr; i<this->n; ++i) {
             this->str[i].setTo(str[i%nrstr]);
         }
     }
@@ -201,7 +237,7 @@ StriContainerUTF16::StriContainerUTF16(StriContainerUTF16& container)
         STRI_ASSERT(this->str);
         if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR_WITH_SIZE,
                                                 this->n*sizeof(UnicodeString));
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->str[i].setTo(container.str[i]);
         }
     }
@@ -225,7 +261,7 @@ StriContainerUTF16& StriContainerUTF16::operator=(StriContainerUTF16& container)
         STRI_ASSERT(this->str);
         if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR_WITH_SIZE,
                                                 this->n*sizeof(UnicodeString));
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->str[i].setTo(container.str[i]);
         }
     }
@@ -264,7 +300,7 @@ StriContainerUTF16::~StriContainerUTF16()
 SEXP StriContainerUTF16::toR() const
 {
     R_len_t outbufsize = 0;
-    for (R_len_t i=0; i<nrecycle; ++i) {
+    for (R_xlen_t i=0; i<nrecycle; ++i) {
         if (!str[i%n].isBogus()) {
             R_len_t thissize = str[i%n].length();
             if (thissize > outbufsize)
@@ -280,7 +316,7 @@ SEXP StriContainerUTF16::toR() const
     PROTECT(ret = Rf_allocVector(STRSXP, nrecycle));
 
     UErrorCode status = U_ZERO_ERROR;
-    for (R_len_t i=0; i<nrecycle; ++i) {
+    for (R_xlen_t i=0; i<nrecycle; ++i) {
         if (str[i%n].isBogus())
             SET_STRING_ELT(ret, i, NA_STRING);
         else {
@@ -305,7 +341,7 @@ SEXP StriContainerUTF16::toR() const
  *  @param i index [with recycle]
  *  @return CHARSXP
  */
-SEXP StriContainerUTF16::toR(R_len_t i) const
+SEXP StriContainerUTF16::toR(R_xlen_t i) const
 {
 #ifndef NDEBUG
     if (i < 0 || i >= nrecycle)
@@ -339,7 +375,7 @@ SEXP StriContainerUTF16::toR(R_len_t i) const
  * @version 1.7.1 (Marek Gagolewski, 2021-06-29) ignore NA and negative indexes
  */
 void StriContainerUTF16::UChar16_to_UChar32_index(
-    R_len_t i,
+    R_xlen_t i,
     int* i1, int* i2, const int ni, int adj1, int adj2
 ) {
     const UnicodeString* str_data = &(this->get(i));
@@ -68,12 +68,12 @@ protected:
 public:
 
     StriContainerUTF16();
-    StriContainerUTF16(R_len_t nrecycle);
-    StriContainerUTF16(SEXP rstr, R_len_t nrecycle, bool shallowrecycle=true);
+    StriContainerUTF16(R_xlen_t nrecycle);
+    StriContainerUTF16(SEXP rstr, R_xlen_t nrecycle, bool shallowrecycle=true);
     StriContainerUTF16(StriContainerUTF16& container);
     ~StriContainerUTF16();
     StriContainerUTF16& operator=(StriContainerUTF16& container);
-    SEXP toR(R_len_t i) const;
+    SEXP toR(R_xlen_t i) const;
     SEXP toR() const;
 
 
@@ -81,7 +81,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (!str)
             throw StriException("StriContainerUTF16::isNA(): !str");
@@ -96,7 +96,7 @@ public:
      * @param i index
      * @return string
      */
-    inline const UnicodeString& get(R_len_t i) const {
+    inline const UnicodeString& get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (isNA(i))
             throw StriException("StriContainerUTF16::get(): isNA");
@@ -108,7 +108,7 @@ public:
      * @param i index
      * @return string
      */
-    inline UnicodeString& getWritable(R_len_t i) {
+    inline UnicodeString& getWritable(R_xlen_t i) {
 #ifndef NDEBUG
         if (isShallow)
             throw StriException("StriContainerUTF16::getWritable(): shallow StriContainerUTF16");
@@ -126,7 +126,7 @@ public:
     /** set NA
      * @param i index
      */
-    inline void setNA(R_len_t i) {
+    inline void setNA(R_xlen_t i) {
 #ifndef NDEBUG
         if (isShallow)
             throw StriException("StriContainerUTF16::getWritable(): shallow StriContainerUTF16");
@@ -142,7 +142,7 @@ public:
      * @param i index
      * @param s string to be copied
      */
-    inline void set(R_len_t i, const UnicodeString& s) {
+    inline void set(R_xlen_t i, const UnicodeString& s) {
 #ifndef NDEBUG
         if (isShallow)
             throw StriException("StriContainerUTF16::set(): shallow StriContainerUTF16");
@@ -157,7 +157,7 @@ public:
     }
 
     // @QUESTION: separate StriContainerUTF16_indexable?
-    void UChar16_to_UChar32_index(R_len_t i, int* i1, int* i2, const int ni, int adj1, int adj2);
+    void UChar16_to_UChar32_index(R_xlen_t i, int* i1, int* i2, const int ni, int adj1, int adj2);
 };
 
 
@@ -58,8 +58,11 @@ StriContainerUTF8::StriContainerUTF8()
  *
  * @version 1.6.2 (Marek Gagolewski, 2021-05-14)
  *    #354 Force the copying of ALTREP data
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    convert from single-byte encodings via a lookup table
  */
-StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallowrecycle)
+StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_xlen_t _nrecycle, bool _shallowrecycle)
 {
     this->str = NULL;
 
@@ -67,7 +70,7 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
     if (!Rf_isString(rstr))
         throw StriException("DEBUG: !Rf_isString in StriContainerUTF8::StriContainerUTF8(SEXP rstr)");
 #endif
-    R_len_t nrstr = LENGTH(rstr);
+    R_xlen_t nrstr = XLENGTH(rstr);
     this->init_Base(nrstr, _nrecycle, _shallowrecycle, rstr); // calling LENGTH(rstr) fails on constructor call
 
     if (this->n == 0)
@@ -97,7 +100,7 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
 //      int    tmpbufsize = -1;
 //      UChar* tmpbuf = NULL;
 
-    for (R_len_t i=0; i<nrstr; ++i) {
+    for (R_xlen_t i=0; i<nrstr; ++i) {
         SEXP curs = STRING_ELT(rstr, i);
         if (curs == NA_STRING) {
             continue; // keep NA
@@ -123,6 +126,7 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
         else {
 //             LATIN1 ------- OR ------ Native encoding
 
+            StriUcnv* ucnvCurrentObj = &ucnvLatin1;
             UConverter* ucnvCurrent;
             if (IS_LATIN1(curs)) {
                 ucnvCurrent = ucnvLatin1.getConverter();
@@ -139,12 +143,13 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
                 }
 
                 ucnvCurrent = ucnvNative.getConverter();
+                ucnvCurrentObj = &ucnvNative;
             }
 
             if (outbufsize < 0) {
                 // calculate max string length
                 R_len_t maxlen = LENGTH(curs);
-                for (R_len_t z=i+1; z<nrstr; ++z) {
+                for (R_xlen_t z=i+1; z<nrstr; ++z) {
                     // start from the current string (there's no need to re-encode for < i)
                     SEXP tmps = STRING_ELT(rstr, z);
                     if ((tmps != NA_STRING)
@@ -163,6 +168,19 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
             }
 
 
+            // version 0: single-byte encodings (e.g., latin1) -> UTF-8 directly
+            const UChar32* sbcs_table = ucnvCurrentObj->getSBCSTable();
+            if (sbcs_table) {
+                R_len_t outrealsize = stri__sbcs_to_utf8(CHAR(curs), LENGTH(curs),
+                    sbcs_table, outbuf.data());
+                if (outrealsize >= 0) {
+                    this->str[i].initialize(outbuf.data(), outrealsize, true/*memalloc*/, false/*killbom*/, false/*isASCII*/);
+                    continue;
+                }
+                // unmapped bytes: let ICU substitute them
+            }
+
+
             // version 1: use ucnv's pivot buffer (slower than v2)
 //               UErrorCode status = U_ZERO_ERROR;
 //               int realsize = ucnv_toAlgorithmic(UCNV_UTF8, ucnvCurrent,
@@ -224,7 +242,7 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
     }
 
     if (!_shallowrecycle) {
-        for (R_len_t i=nrstr; i<this->n; ++i) {
+        for (R_xlen_t i=nrstr; i<this->n; ++i) {
             this->str[i] = str[i%nrstr];
         }
     }
@@ -239,7 +257,7 @@ StriContainerUTF8::StriContainerUTF8(StriContainerUTF8& container)
         STRI_ASSERT(this->str);
         if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR_WITH_SIZE,
                                                 this->n*sizeof(String8));
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->str[i] = container.str[i];
         }
     }
@@ -259,7 +277,7 @@ StriContainerUTF8& StriContainerUTF8::operator=(StriContainerUTF8& container)
         STRI_ASSERT(this->str);
         if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR_WITH_SIZE,
                                                 this->n*sizeof(String8));
-        for (int i=0; i<this->n; ++i) {
+        for (R_xlen_t i=0; i<this->n; ++i) {
             this->str[i] = container.str[i];
         }
     }
@@ -273,7 +291,7 @@ StriContainerUTF8& StriContainerUTF8::operator=(StriContainerUTF8& container)
 StriContainerUTF8::~StriContainerUTF8()
 {
     if (str) {
-//      for (int i=0; i<n; ++i) {
+//      for (R_xlen_t i=0; i<n; ++i) {
 //         if (str[i])
 //            delete str[i];
 //      }
@@ -304,7 +322,7 @@ SEXP StriContainerUTF8::toR() const
     SEXP ret;
     PROTECT(ret = Rf_allocVector(STRSXP, nrecycle));
 
-    for (R_len_t i=0; i<nrecycle; ++i) {
+    for (R_xlen_t i=0; i<nrecycle; ++i) {
         SET_STRING_ELT(ret, i, this->toR(i));
     }
 
@@ -324,7 +342,7 @@ SEXP StriContainerUTF8::toR() const
  * @version 0.2-1 (Marek Gagolewski, 2014-03-22)
  *    returns original CHARSXP if possible for increased performance
  */
-SEXP StriContainerUTF8::toR(R_len_t i) const
+SEXP StriContainerUTF8::toR(R_xlen_t i) const
 {
 #ifndef NDEBUG
     if (i < 0 || i >= nrecycle)
@@ -73,6 +73,9 @@
  * @version 0.3-1 (Marek Gagolewski, 2014-11-02)
  *          New methods: set, getWritable, isNA;
  *          Always try to use shallow copy of char* data in SEXP-based constructor (be lazy)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          New methods: isUTF8Source, getSourceUTF8
  */
 class StriContainerUTF8 : public StriContainerBase {
 
@@ -84,11 +87,11 @@ private:
 public:
 
     StriContainerUTF8();
-    StriContainerUTF8(SEXP rstr, R_len_t nrecycle, bool shallowrecycle=true);
+    StriContainerUTF8(SEXP rstr, R_xlen_t nrecycle, bool shallowrecycle=true);
     StriContainerUTF8(StriContainerUTF8& container);
     ~StriContainerUTF8();
     StriContainerUTF8& operator=(StriContainerUTF8& container);
-    SEXP toR(R_len_t i) const;
+    SEXP toR(R_xlen_t i) const;
     SEXP toR() const;
 
 
@@ -96,7 +99,7 @@ public:
      * @param i index
      * @return true if is NA
      */
-    inline bool isNA(R_len_t i) const {
+    inline bool isNA(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerUTF8::isNA(): INDEX OUT OF BOUNDS");
@@ -110,7 +113,7 @@ public:
      * @param i index
      * @return string, read only
      */
-    inline const String8& get(R_len_t i) const {
+    inline const String8& get(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerUTF8::get(): INDEX OUT OF BOUNDS");
@@ -126,7 +129,7 @@ public:
      * @param i index
      * @return string, read only
      */
-    inline const String8& getNAble(R_len_t i) const {
+    inline const String8& getNAble(R_xlen_t i) const {
 #ifndef NDEBUG
         if (i < 0 || i >= nrecycle)
             throw StriException("StriContainerUTF8::get(): INDEX OUT OF BOUNDS");
@@ -140,7 +143,7 @@ public:
      * @param i index
      * @return string
      */
-    inline String8& getWritable(R_len_t i) {
+    inline String8& getWritable(R_xlen_t i) {
 #ifndef NDEBUG
         if (isShallow)
             throw StriException("StriContainerUTF8::getWritable(): shallow StriContainerUTF8");
@@ -160,7 +163,7 @@ public:
     /** set NA
      * @param i index
      */
-    inline void setNA(R_len_t i) {
+    inline void setNA(R_xlen_t i) {
 #ifndef NDEBUG
         if (isShallow)
             throw StriException("StriContainerUTF8::setNA(): shallow StriContainerUTF8");
@@ -173,10 +176,73 @@ public:
     }
 
 
+    /** get the CHARSXP whose data the vectorized ith element is
+     *  a read-only view of (see String8::isReadOnly)
+     *
+     * @param i index
+     * @return CHARSXP or NULL if the string is NA or had to be re-encoded
+     *
+     * @version 1.8.8 (2026-10-19)
+     */
+    inline SEXP getSource(R_xlen_t i) const {
+#ifndef NDEBUG
+        if (i < 0 || i >= nrecycle)
+            throw StriException("StriContainerUTF8::getSource(): INDEX OUT OF BOUNDS");
+#endif
+        if (str[i%n].isNA() || !str[i%n].isReadOnly())
+            return NULL;
+        return STRING_ELT(sexp, i%XLENGTH(sexp));
+    }
+
+
+    /** can a CHARSXP be used as-is where a UTF-8 string is expected?
+     *
+     * Natively encoded strings cannot, even in a UTF-8 locale:
+     * they would keep their native encoding mark.
+     *
+     * @param curs CHARSXP, not NA
+     * @return whether curs is in ASCII or marked as UTF-8
+     *
+     * @version 1.8.8 (2026-10-19)
+     */
+    static inline bool isUTF8Source(SEXP curs) {
+        return IS_ASCII(curs) || IS_UTF8(curs);
+    }
+
+
+    /** get the CHARSXP whose data the vectorized ith element is
+     *  a read-only view of, provided that it may be returned as-is
+     *  as the ith result string (see isUTF8Source)
+     *
+     * @param i index
+     * @return CHARSXP or NULL if it cannot be reused
+     *
+     * @version 1.8.8 (2026-10-19)
+     */
+    inline SEXP getSourceUTF8(R_xlen_t i) const {
+        SEXP src = getSource(i);
+        return (src != NULL && isUTF8Source(src)) ? src : NULL;
+    }
+
+
+    /** are all the non-missing strings read-only views of the CHARSXPs
+     *  in the underlying R character vector?
+     *
+     * @version 1.8.8 (2026-10-19)
+     */
+    bool isReadOnly() const {
+        for (R_xlen_t i=0; i<n; ++i) {
+            if (!str[i].isNA() && !str[i].isReadOnly())
+                return false;
+        }
+        return true;
+    }
+
+
     /** get the number of bytes used to represent the longest string */
     R_len_t getMaxNumBytes() const {
         R_len_t bufsize = 0;
-        for (R_len_t i=0; i<n; ++i) {
+        for (R_xlen_t i=0; i<n; ++i) {
             if (isNA(i)) continue;
             R_len_t cursize = get(i).length();
             if (cursize > bufsize)
@@ -189,7 +255,7 @@ public:
     /** get the length of the longest string */
     R_len_t getMaxLength() const {
         R_len_t bufsize = 0;
-        for (R_len_t i=0; i<n; ++i) {
+        for (R_xlen_t i=0; i<n; ++i) {
             if (isNA(i)) continue;
             R_len_t cursize = get(i).countCodePoints();
             if (cursize > bufsize)
@@ -203,7 +269,7 @@ public:
      * @param i index
      * @param s string to be copied
      */
-    inline void set(R_len_t i, const String8& s) {
+    inline void set(R_xlen_t i, const String8& s) {
 #ifndef NDEBUG
         if (isShallow)
             throw StriException("StriContainerUTF8::set(): shallow StriContainerUTF8");
@@ -57,7 +57,7 @@ StriContainerUTF8_indexable::StriContainerUTF8_indexable()
  *  @version 0.2-1 (2014-03-20)
  *           separated StriContainerUTF8_indexable class
  */
-StriContainerUTF8_indexable::StriContainerUTF8_indexable(SEXP rstr, R_len_t _nrecycle, bool _shallowrecycle)
+StriContainerUTF8_indexable::StriContainerUTF8_indexable(SEXP rstr, R_xlen_t _nrecycle, bool _shallowrecycle)
     : StriContainerUTF8(rstr, _nrecycle, _shallowrecycle)
 {
     last_ind_back_str = NULL;
@@ -121,7 +121,7 @@ StriContainerUTF8_indexable& StriContainerUTF8_indexable::operator=(StriContaine
  * @version 1.1.3 (Marek Gagolewski, 2017-03-21)
  *          Issue#227: buffering bug in stri_sub
  */
-R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_back(R_len_t i, R_len_t wh)
+R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_back(R_xlen_t i, R_len_t wh)
 {
     R_len_t cur_n = get(i).length();
     if (wh <= 0) return cur_n;
@@ -207,8 +207,11 @@ R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_back(R_len_t i, R_len
  *
  * @version 1.1.3 (Marek Gagolewski, 2017-03-21)
  *          Issue#227: buffering bug in stri_sub
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          skip ASCII runs block-wise (stri__utf8_ascii_prefix)
  */
-R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_fwd(R_len_t i, R_len_t wh)
+R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_fwd(R_xlen_t i, R_len_t wh)
 {
     if (wh <= 0) return 0;
     if (get(i).isASCII()) return std::min(wh, get(i).length());
@@ -259,6 +262,13 @@ R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_fwd(R_len_t i, R_len_
 
     // go forward
     while (j < wh && jres < cur_n) {
+        // each ASCII byte is a single code point
+        R_len_t nascii = stri__utf8_ascii_prefix(cur_s+jres, cur_n-jres);
+        if (nascii > wh-j) nascii = wh-j;
+        j    += nascii;
+        jres += nascii;
+        if (j >= wh || jres >= cur_n) break;
+
         U8_FWD_1((const uint8_t*)cur_s, jres, cur_n);
         ++j;
     }
@@ -289,7 +299,7 @@ R_len_t StriContainerUTF8_indexable::UChar32_to_UTF8_index_fwd(R_len_t i, R_len_
 * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
 *          use String8::isASCII
 */
-void StriContainerUTF8_indexable::UTF8_to_UChar32_index(R_len_t i,
+void StriContainerUTF8_indexable::UTF8_to_UChar32_index(R_xlen_t i,
         int* i1, int* i2, const int ni, int adj1, int adj2)
 {
     if (get(i).isASCII()) {
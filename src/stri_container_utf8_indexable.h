@@ -65,13 +65,13 @@ private:
 public:
 
     StriContainerUTF8_indexable();
-    StriContainerUTF8_indexable(SEXP rstr, R_len_t nrecycle, bool shallowrecycle=true);
+    StriContainerUTF8_indexable(SEXP rstr, R_xlen_t nrecycle, bool shallowrecycle=true);
     StriContainerUTF8_indexable(StriContainerUTF8_indexable& container);
     StriContainerUTF8_indexable& operator=(StriContainerUTF8_indexable& container);
 
-    void UTF8_to_UChar32_index(R_len_t i, int* i1, int* i2, const int ni, int adj1, int adj2);
-    R_len_t UChar32_to_UTF8_index_back(R_len_t i, R_len_t wh);
-    R_len_t UChar32_to_UTF8_index_fwd(R_len_t i, R_len_t wh);
+    void UTF8_to_UChar32_index(R_xlen_t i, int* i1, int* i2, const int ni, int adj1, int adj2);
+    R_len_t UChar32_to_UTF8_index_back(R_xlen_t i, R_len_t wh);
+    R_len_t UChar32_to_UTF8_index_fwd(R_xlen_t i, R_len_t wh);
 };
 
 #endif
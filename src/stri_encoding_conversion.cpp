@@ -37,12 +37,94 @@
 #include "stri_container_listint.h"
 #include "stri_string8buf.h"
 #include "stri_ucnv.h"
+#include "stri_packed.h"
 #include <vector>
+#include <string>
 
 
 #define BUF_MAX_LENGTH 2147483647
 
 
+/* output types of stri_encode, see stri__prepare_arg_to_raw */
+#define STRI__ENCODE_TO_STRING 0
+#define STRI__ENCODE_TO_RAW    1
+#define STRI__ENCODE_TO_PACKED 2
+
+
+/** Prepare the to_raw argument of stri_encode: TRUE, FALSE, or "packed"
+ *
+ * WARNING: this function is allowed to call the error() function.
+ *
+ * @param to_raw R object
+ * @return one of STRI__ENCODE_TO_*
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static int stri__prepare_arg_to_raw(SEXP to_raw)
+{
+    if (Rf_isString(to_raw) && LENGTH(to_raw) == 1 &&
+            STRING_ELT(to_raw, 0) != NA_STRING &&
+            !strcmp(CHAR(STRING_ELT(to_raw, 0)), "packed"))
+        return STRI__ENCODE_TO_PACKED;
+    else if (stri__prepare_arg_logical_1_notNA(to_raw, "to_raw"))
+        return STRI__ENCODE_TO_RAW;
+    else
+        return STRI__ENCODE_TO_STRING;
+}
+
+
+/** Store the i-th result of stri_encode
+ *
+ * @param ret character vector, list, or R_NilValue (packed output)
+ * @param packed packed output (to_raw == STRI__ENCODE_TO_PACKED)
+ * @param to_raw one of STRI__ENCODE_TO_*
+ * @param encmark encoding mark of the output strings
+ * @param i index
+ * @param s converted string or NULL for NA
+ * @param n number of bytes in s
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static void stri__encode_set(SEXP ret, StriPackedRaw& packed, int to_raw,
+    cetype_t encmark, R_xlen_t i, const char* s, R_len_t n)
+{
+    if (to_raw == STRI__ENCODE_TO_PACKED) {
+        if (s) packed.add(s, (size_t)n);
+        else   packed.addNA();
+    }
+    else if (to_raw == STRI__ENCODE_TO_RAW) {
+        if (!s) {
+            SET_VECTOR_ELT(ret, i, R_NilValue);
+            return;
+        }
+        SEXP outobj;
+        PROTECT(outobj = Rf_allocVector(RAWSXP, n));
+        memcpy(RAW(outobj), s, (size_t)n);
+        SET_VECTOR_ELT(ret, i, outobj);
+        UNPROTECT(1);
+    }
+    else {
+        SET_STRING_ELT(ret, i, s ? Rf_mkCharLenCE(s, n, encmark) : NA_STRING);
+    }
+}
+
+
+/** Allocate the output of stri_encode
+ *
+ * @param to_raw one of STRI__ENCODE_TO_*
+ * @param n length
+ * @return list, character vector, or R_NilValue (packed output), unprotected
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static SEXP stri__encode_alloc(int to_raw, R_xlen_t n)
+{
+    if (to_raw == STRI__ENCODE_TO_PACKED)
+        return R_NilValue;
+    return Rf_allocVector((to_raw == STRI__ENCODE_TO_RAW)?VECSXP:STRSXP, n);
+}
+
+
 /** Convert from UTF-32
  *
  * @param vec integer vector or list with integer vectors
@@ -56,6 +138,9 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII fast path
  */
 SEXP stri_enc_fromutf32(SEXP vec)
 {
@@ -92,6 +177,10 @@ SEXP stri_enc_fromutf32(SEXP vec)
         UBool err = FALSE;
         while (!err && k < cur_n) {
             c = cur_data[k++];
+            if (c > 0 && c <= ASCII_MAXCHARCODE) {
+                bufdata[j++] = (char)c;  // the most common case
+                continue;
+            }
             U8_APPEND((uint8_t*)bufdata, j, bufsize, c, err);
 
             // Rf_mkCharLenCE detects embedded nuls, but stops execution completely
@@ -131,6 +220,9 @@ SEXP stri_enc_fromutf32(SEXP vec)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    validate first, then decode directly into the output vector
  */
 SEXP stri_enc_toutf32(SEXP str)
 {
@@ -140,18 +232,6 @@ SEXP stri_enc_toutf32(SEXP str)
     STRI__ERROR_HANDLER_BEGIN(1)
     StriContainerUTF8 str_cont(str, n);
 
-    R_len_t bufsize = 1; // to avoid allocating an empty buffer
-    for (R_len_t i=0; i<n; ++i) {
-        if (str_cont.isNA(i)) continue;
-        R_len_t ni = str_cont.get(i).length();
-        if (ni > bufsize) bufsize = ni;
-    }
-
-    UChar32* buf = (UChar32*)R_alloc((size_t)bufsize, (int)sizeof(UChar32)); // at most bufsize UChars32 (bufsize/4 min.)
-    STRI_ASSERT(buf);
-    if (!buf) throw StriException(MSG__MEM_ALLOC_ERROR);
-    // deque<UChar32> was slower than using a common, over-sized buf
-
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(VECSXP, n)); // all
 
@@ -162,25 +242,19 @@ SEXP stri_enc_toutf32(SEXP str)
             continue;
         }
 
-        UChar32 c = (UChar32)0;
         const char* s = str_cont.get(i).c_str();
         R_len_t sn = str_cont.get(i).length();
-        R_len_t j = 0;
-        R_len_t k = 0;
-        while (c >= 0 && j < sn) {
-            U8_NEXT(s, j, sn, c);
-            buf[k++] = (int)c;
-        }
 
-        if (c < 0) {
+        if (stri__utf8_invalid_offset(s, sn) >= 0) {
             throw StriException(MSG__INVALID_UTF8);
 //             SET_VECTOR_ELT(ret, i, R_NilValue);
 //             continue;
         }
         else {
+            // decode directly into the output vector
             SEXP conv;
-            STRI__PROTECT(conv = Rf_allocVector(INTSXP, k));
-            memcpy(INTEGER(conv), buf, (size_t)sizeof(int)*k);
+            STRI__PROTECT(conv = Rf_allocVector(INTSXP, stri__utf8_count_codepoints(s, sn)));
+            stri__utf8_decode(s, sn, (UChar32*)INTEGER(conv));
             SET_VECTOR_ELT(ret, i, conv);
             STRI__UNPROTECT(1);
         }
@@ -217,6 +291,9 @@ SEXP stri_enc_toutf32(SEXP str)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    validate using stri__utf8_invalid_offset; copy the valid prefix as-is
  */
 SEXP stri_enc_toutf8(SEXP str, SEXP is_unknown_8bit, SEXP validate)
 {
@@ -299,13 +376,10 @@ SEXP stri_enc_toutf8(SEXP str, SEXP is_unknown_8bit, SEXP validate)
 
             const char* s = CHAR(curs);  // TODO: ALTREP will be problematic?
             R_len_t sn = LENGTH(curs);
-            R_len_t j = 0;
+            R_len_t j = stri__utf8_invalid_offset(s, sn);
             UChar32 c = 0;
-            while (c >= 0 && j < sn) {
-                U8_NEXT(s, j, sn, c);
-            }
 
-            if (c >= 0) continue; // valid, nothing to do
+            if (j < 0) continue; // valid, nothing to do
 
             if (LOGICAL(validate)[0] == NA_LOGICAL) {
                 Rf_warning(MSG__INVALID_CODE_POINT_REPLNA);
@@ -316,8 +390,9 @@ SEXP stri_enc_toutf8(SEXP str, SEXP is_unknown_8bit, SEXP validate)
                 String8buf buf(bufsize); // maximum: 1 byte -> U+FFFD (3 bytes)
                 char* bufdata = buf.data();
 
-                j = 0;
-                size_t k = 0;
+                // everything before the first ill-formed sequence is fine
+                memcpy(bufdata, s, (size_t)j);
+                size_t k = (size_t)j;
                 UBool err = FALSE;
                 while (!err && j < sn) {
                     U8_NEXT(s, j, sn, c);
@@ -460,12 +535,12 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     const char* selected_to   = stri__prepare_arg_enc(to, "to", true); /* this is R_alloc'ed */
-    bool to_raw_logical = stri__prepare_arg_logical_1_notNA(to_raw, "to_raw");
+    int to_raw_type = stri__prepare_arg_to_raw(to_raw);
 
     R_len_t str_n = LENGTH(str);
-    if (str_n <= 0) {
+    if (str_n <= 0 && to_raw_type != STRI__ENCODE_TO_PACKED) {
         UNPROTECT(1);
-        return Rf_allocVector(to_raw_logical?VECSXP:STRSXP, 0);
+        return stri__encode_alloc(to_raw_type, 0);
     }
 
     STRI__ERROR_HANDLER_BEGIN(1)
@@ -478,11 +553,12 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
     UConverter* uconv_to = ucnv.getConverter(true /*register_callbacks*/);
 
     // Get target encoding mark
-    cetype_t encmark_to = to_raw_logical?CE_BYTES:ucnv.getCE();
+    cetype_t encmark_to = (to_raw_type != STRI__ENCODE_TO_STRING)?CE_BYTES:ucnv.getCE();
 
     // Prepare out val
     SEXP ret;
-    STRI__PROTECT(ret = Rf_allocVector(to_raw_logical?VECSXP:STRSXP, str_n));
+    STRI__PROTECT(ret = stri__encode_alloc(to_raw_type, str_n));
+    StriPackedRaw packed(str_n);
 
     // calculate required buf size
     size_t bufsize = 0;
@@ -498,8 +574,7 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
 
     for (R_len_t i=0; i<str_n; ++i) {
         if (str_cont.isNA(i)) {
-            if (to_raw_logical) SET_VECTOR_ELT(ret, i, R_NilValue);
-            else                SET_STRING_ELT(ret, i, NA_STRING);
+            stri__encode_set(ret, packed, to_raw_type, encmark_to, i, NULL, 0);
             continue;
         }
 
@@ -526,19 +601,12 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
 
-        if (to_raw_logical) {
-            SEXP outobj;
-            STRI__PROTECT(outobj = Rf_allocVector(RAWSXP, bufneed));
-            memcpy(RAW(outobj), buf.data(), (size_t)bufneed);
-            SET_VECTOR_ELT(ret, i, outobj);
-            STRI__UNPROTECT(1);
-        }
-        else {
-            SET_STRING_ELT(ret, i,
-                           Rf_mkCharLenCE(buf.data(), bufneed, encmark_to));
-        }
+        stri__encode_set(ret, packed, to_raw_type, encmark_to, i, buf.data(), bufneed);
     }
 
+    if (to_raw_type == STRI__ENCODE_TO_PACKED)
+        STRI__PROTECT(ret = packed.toR());
+
     STRI__UNPROTECT_ALL
     return ret;
 
@@ -546,6 +614,61 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
 }
 
 
+/**
+ * Convert a string with a dedicated kernel instead of ICU, if possible
+ *
+ * Supported are: UTF-8 -> UTF-16LE/BE, UTF-32LE/BE and
+ * UTF-16LE/BE, UTF-32LE/BE, single-byte encodings -> UTF-8.
+ * Ill-formed input is left for ICU to deal with (substitute and warn).
+ *
+ * @param s input string
+ * @param n number of bytes in s
+ * @param ucnv_from source converter
+ * @param ucnv_to target converter
+ * @param buf [out] output buffer (resized if necessary)
+ * @return number of bytes written to buf or -1 if ICU must be used
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static R_len_t stri__encode_kernel(const char* s, R_len_t n,
+    StriUcnv& ucnv_from, StriUcnv& ucnv_to, String8buf& buf)
+{
+    int kfrom = ucnv_from.getKernelType();
+    int kto = ucnv_to.getKernelType();
+    if ((kfrom == STRI__UCNV_KERNEL_UTF8) == (kto == STRI__UCNV_KERNEL_UTF8))
+        return -1;  // UTF-8 -> UTF-8 is dealt with elsewhere
+    if (kfrom == STRI__UCNV_KERNEL_NONE || kto == STRI__UCNV_KERNEL_NONE ||
+            kto == STRI__UCNV_KERNEL_SBCS)
+        return -1;
+    if ((size_t)n*4 > (size_t)BUF_MAX_LENGTH)
+        return -1;
+
+    buf.resize((size_t)n*4+1, false/*destroy contents*/); // grows or stays as-is
+    char* out = buf.data();
+
+    switch (kfrom) {
+    case STRI__UCNV_KERNEL_UTF8:
+        if (stri__utf8_invalid_offset(s, n) >= 0)
+            return -1;
+        switch (kto) {
+        case STRI__UCNV_KERNEL_UTF16LE: return stri__utf8_to_utf16(s, n, out, false);
+        case STRI__UCNV_KERNEL_UTF16BE: return stri__utf8_to_utf16(s, n, out, true);
+        case STRI__UCNV_KERNEL_UTF32LE: return stri__utf8_to_utf32(s, n, out, false);
+        case STRI__UCNV_KERNEL_UTF32BE: return stri__utf8_to_utf32(s, n, out, true);
+        default: return -1;
+        }
+    case STRI__UCNV_KERNEL_UTF16LE: return stri__utf16_to_utf8(s, n, out, false);
+    case STRI__UCNV_KERNEL_UTF16BE: return stri__utf16_to_utf8(s, n, out, true);
+    case STRI__UCNV_KERNEL_UTF32LE: return stri__utf32_to_utf8(s, n, out, false);
+    case STRI__UCNV_KERNEL_UTF32BE: return stri__utf32_to_utf8(s, n, out, true);
+    case STRI__UCNV_KERNEL_SBCS:
+        return stri__sbcs_to_utf8(s, n, ucnv_from.getSBCSTable(), out);
+    default:
+        return -1;
+    }
+}
+
+
 /**
  * Convert character vector between given encodings
  *
@@ -577,6 +700,10 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    UTF-8 -> UTF-8: copy well-formed strings as-is;
+ *    use dedicated kernels for UTF-16/32 and single-byte encodings
  */
 SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
 {
@@ -584,7 +711,7 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
     if (!selected_from && Rf_isVectorAtomic(str) && !isRaw(str))
         return stri_encode_from_marked(str, to, to_raw);
     const char* selected_to   = stri__prepare_arg_enc(to, "to", true); /* this is R_alloc'ed */
-    bool to_raw_logical = stri__prepare_arg_logical_1_notNA(to_raw, "to_raw");
+    int to_raw_type = stri__prepare_arg_to_raw(to_raw);
 
     // raw vector, character vector, or list of raw vectors:
     PROTECT(str = stri__prepare_arg_list_raw(str, "str"));
@@ -595,9 +722,9 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
     R_len_t str_n = str_cont.get_n();
 
     // get the number of strings to convert; if == 0, then you know what's the result
-    if (str_n <= 0) {
+    if (str_n <= 0 && to_raw_type != STRI__ENCODE_TO_PACKED) {
         STRI__UNPROTECT_ALL
-        return Rf_allocVector(to_raw_logical?VECSXP:STRSXP, 0);
+        return stri__encode_alloc(to_raw_type, 0);
     }
 
     // Open converters
@@ -606,11 +733,15 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
     UConverter* uconv_from = ucnv1.getConverter(true /*register_callbacks*/);
     UConverter* uconv_to   = ucnv2.getConverter(true /*register_callbacks*/);
 
+    // UTF-8 -> UTF-8: well-formed strings need no conversion
+    bool utf8_to_utf8 = ucnv1.isUTF8() && ucnv2.isUTF8();
+
     // Get target encoding mark
-    cetype_t encmark_to = to_raw_logical?CE_BYTES:ucnv2.getCE();
+    cetype_t encmark_to = (to_raw_type != STRI__ENCODE_TO_STRING)?CE_BYTES:ucnv2.getCE();
 
     SEXP ret;
-    STRI__PROTECT(ret = Rf_allocVector(to_raw_logical?VECSXP:STRSXP, str_n));
+    STRI__PROTECT(ret = stri__encode_alloc(to_raw_type, str_n));
+    StriPackedRaw packed(str_n);
 
 
 //   // estimate required buf size
@@ -626,14 +757,24 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
 
     for (R_len_t i=0; i<str_n; ++i) {
         if (str_cont.isNA(i)) {
-            if (to_raw_logical) SET_VECTOR_ELT(ret, i, R_NilValue);
-            else                SET_STRING_ELT(ret, i, NA_STRING);
+            stri__encode_set(ret, packed, to_raw_type, encmark_to, i, NULL, 0);
             continue;
         }
 
         const char* curs = str_cont.get(i).c_str();
         R_len_t curn     = str_cont.get(i).length();
 
+        if (utf8_to_utf8 && stri__utf8_invalid_offset(curs, curn) < 0) {
+            stri__encode_set(ret, packed, to_raw_type, encmark_to, i, curs, curn);
+            continue;
+        }
+
+        R_len_t bufkernel = stri__encode_kernel(curs, curn, ucnv1, ucnv2, buf);
+        if (bufkernel >= 0) {
+            stri__encode_set(ret, packed, to_raw_type, encmark_to, i, buf.data(), bufkernel);
+            continue;
+        }
+
         UErrorCode status = U_ZERO_ERROR;
         UnicodeString encs(curs, curn, uconv_from, status); // FROM -> UTF-16 [this is the slow part]
         if (status == U_ILLEGAL_ARGUMENT_ERROR)
@@ -670,18 +811,147 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
 
-        if (to_raw_logical) {
-            SEXP outobj;
-            STRI__PROTECT(outobj = Rf_allocVector(RAWSXP, bufneed));
-            memcpy(RAW(outobj), buf.data(), (size_t)bufneed);
-            SET_VECTOR_ELT(ret, i, outobj);
-            STRI__UNPROTECT(1);
+        stri__encode_set(ret, packed, to_raw_type, encmark_to, i, buf.data(), bufneed);
+    }
+
+    if (to_raw_type == STRI__ENCODE_TO_PACKED)
+        STRI__PROTECT(ret = packed.toR());
+
+    STRI__UNPROTECT_ALL
+    return ret;
+
+    STRI__ERROR_HANDLER_END({/* no special action on error */})
+}
+
+
+/** Hexadecimal representation of a byte sequence (for diagnostics)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static std::string stri__encode_hex(const char* s, size_t n)
+{
+    static const char* digits = "0123456789abcdef";
+    std::string out;
+    for (size_t k = 0; k < n; ++k) {
+        if (k > 0) out += ' ';
+        out += digits[((uint8_t)s[k]) >> 4];
+        out += digits[((uint8_t)s[k]) & 0x0f];
+    }
+    return out;
+}
+
+
+/** Compare the dedicated conversion kernels (see \code{stri__encode_kernel},
+ *  \code{stri__sbcs_to_utf16}, \code{stri__utf8_decode})
+ *  against ICU's converters [for testing only]
+ *
+ * @param str list of raw vectors, a raw vector, or a character vector
+ * @param from source encoding
+ * @param to target encoding
+ * @return list with \code{icu} (a list of raw vectors: the results
+ *    of the conversion done by ICU alone, \code{NULL} for missing values),
+ *    \code{kernel} (the number of strings the kernels converted)
+ *    and \code{mismatches} (a character vector, empty if all is well)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_test_encode_kernels(SEXP str, SEXP from, SEXP to)
+{
+    const char* selected_from = stri__prepare_arg_enc(from, "from", true); /* this is R_alloc'ed */
+    const char* selected_to   = stri__prepare_arg_enc(to, "to", true); /* this is R_alloc'ed */
+    PROTECT(str = stri__prepare_arg_list_raw(str, "str"));
+
+    STRI__ERROR_HANDLER_BEGIN(1)
+    StriContainerListRaw str_cont(str);
+    R_len_t str_n = str_cont.get_n();
+
+    StriUcnv ucnv1(selected_from);
+    StriUcnv ucnv2(selected_to);
+    UConverter* uconv_from = ucnv1.getConverter(true /*register_callbacks*/);
+    UConverter* uconv_to   = ucnv2.getConverter(true /*register_callbacks*/);
+    int kfrom = ucnv1.getKernelType();
+
+    SEXP ret_icu;
+    STRI__PROTECT(ret_icu = Rf_allocVector(VECSXP, str_n));
+    std::vector<std::string> mismatches;
+    R_len_t nkernel = 0;
+    String8buf buf(0);
+    std::vector<UChar> buf16;
+    std::vector<UChar32> buf32;
+
+    for (R_len_t i=0; i<str_n; ++i) {
+        if (str_cont.isNA(i)) continue;
+
+        const char* curs = str_cont.get(i).c_str();
+        R_len_t curn     = str_cont.get(i).length();
+        std::string prefix = std::to_string(i+1) + ": " + stri__encode_hex(curs, curn);
+
+        // ICU: FROM -> UTF-16 -> TO
+        UErrorCode status = U_ZERO_ERROR;
+        ucnv_resetToUnicode(uconv_from);
+        UnicodeString encs(curs, curn, uconv_from, status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+        status = U_ZERO_ERROR;
+        ucnv_resetFromUnicode(uconv_to);
+        int32_t icun = ucnv_fromUChars(uconv_to, NULL, 0,
+            encs.getBuffer(), encs.length(), &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR)
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        std::string icus((size_t)icun+1, '\0');
+        status = U_ZERO_ERROR;
+        ucnv_resetFromUnicode(uconv_to);
+        icun = ucnv_fromUChars(uconv_to, &icus[0], icun+1,
+            encs.getBuffer(), encs.length(), &status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        icus.resize(icun);
+
+        SEXP outobj;
+        STRI__PROTECT(outobj = Rf_allocVector(RAWSXP, icun));
+        if (icun > 0) memcpy(RAW(outobj), icus.data(), (size_t)icun);
+        SET_VECTOR_ELT(ret_icu, i, outobj);
+        STRI__UNPROTECT(1);
+
+        // the whole-string kernels, as used by stri_encode
+        R_len_t bufkernel = stri__encode_kernel(curs, curn, ucnv1, ucnv2, buf);
+        if (bufkernel >= 0) {
+            ++nkernel;
+            if (std::string(buf.data(), bufkernel) != icus)
+                mismatches.push_back(prefix +
+                    " | ICU: " + stri__encode_hex(icus.data(), icus.size()) +
+                    " | kernel: " + stri__encode_hex(buf.data(), bufkernel));
         }
-        else {
-            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), bufneed, encmark_to));
+
+        // the kernels used by the string containers and stri_enc_toutf32
+        if (kfrom == STRI__UCNV_KERNEL_SBCS) {
+            buf16.resize(curn+1);
+            R_len_t k = stri__sbcs_to_utf16(curs, curn, ucnv1.getSBCSTable(), buf16.data());
+            if (k >= 0 && UnicodeString(buf16.data(), k) != encs)
+                mismatches.push_back(prefix + " | sbcs_to_utf16");
+        }
+        else if (kfrom == STRI__UCNV_KERNEL_UTF8 && stri__utf8_invalid_offset(curs, curn) < 0) {
+            buf32.resize(curn+1);
+            R_len_t k = stri__utf8_decode(curs, curn, buf32.data());
+            bool ok = (k == encs.countChar32() &&
+                k == stri__utf8_count_codepoints(curs, curn));
+            for (int32_t j = 0, l = 0; ok && l < k; j = encs.moveIndex32(j, 1), ++l)
+                ok = (buf32[l] == encs.char32At(j));
+            if (!ok)
+                mismatches.push_back(prefix + " | utf8_decode");
         }
     }
 
+    SEXP ret, ret_mismatches;
+    STRI__PROTECT(ret = Rf_allocVector(VECSXP, 3));
+    SET_VECTOR_ELT(ret, 0, ret_icu);
+    SET_VECTOR_ELT(ret, 1, Rf_ScalarInteger(nkernel));
+    STRI__PROTECT(ret_mismatches = Rf_allocVector(STRSXP, mismatches.size()));
+    for (size_t k = 0; k < mismatches.size(); ++k)
+        SET_STRING_ELT(ret_mismatches, k,
+            Rf_mkCharLenCE(mismatches[k].c_str(), (int)mismatches[k].size(), CE_UTF8));
+    SET_VECTOR_ELT(ret, 2, ret_mismatches);
+    Rf_setAttrib(ret, R_NamesSymbol,
+        stri__make_character_vector_char_ptr(3, "icu", "kernel", "mismatches"));
     STRI__UNPROTECT_ALL
     return ret;
 
@@ -32,6 +32,7 @@
 
 #include "stri_stringi.h"
 #include <unicode/ucsdet.h>
+#include <unicode/ucnv.h>
 #include <unicode/locid.h>
 #include <unicode/uloc.h>
 #include <unicode/locid.h>
@@ -40,6 +41,7 @@
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <string>
 #include "stri_container_listraw.h"
 #include "stri_container_logical.h"
 #include "stri_ucnv.h"
@@ -144,19 +146,19 @@ double stri__enc_check_ascii(const char* str_cur_s, R_len_t str_cur_n, bool get_
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-08-13)
  *          confidence calculation basing on ICU's i18n/csrutf8.cpp
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          use the block-wise stri__utf8_invalid_offset
  */
 double stri__enc_check_utf8(const char* str_cur_s, R_len_t str_cur_n, bool get_confidence)
 {
     if (!get_confidence) {
-        UChar32 c;
-        for (R_len_t j=0; j < str_cur_n; ) {
-            if (str_cur_s[j] == 0)
-                return 0.0; // definitely not valid UTF-8
-
-            U8_NEXT(str_cur_s, j, str_cur_n, c);
-            if (c < 0) // ICU utf8.h doc for U8_NEXT: c -> output UChar32 variable, set to <0 in case of an error
-                return 0.0; // definitely not valid UTF-8
-        }
+        if (memchr(str_cur_s, 0, str_cur_n))
+            return 0.0; // definitely not valid UTF-8
+
+        if (stri__utf8_invalid_offset(str_cur_s, str_cur_n) >= 0)
+            return 0.0; // definitely not valid UTF-8
+
         return 1.0;
     }
     else {
@@ -165,6 +167,13 @@ double stri__enc_check_utf8(const char* str_cur_s, R_len_t str_cur_n, bool get_c
                        (uint8_t)(str_cur_s[0]) == UTF8_BOM_BYTE1 &&
                        (uint8_t)(str_cur_s[1]) == UTF8_BOM_BYTE2 &&
                        (uint8_t)(str_cur_s[2]) == UTF8_BOM_BYTE3);
+
+        // well-formed UTF-8 (the most common case) has no invalid
+        // sequences below, and each multibyte sequence is counted as valid
+        R_len_t numMultibyte = 0;
+        if (stri__utf8_invalid_offset(str_cur_s, str_cur_n, &numMultibyte) < 0)
+            return (hasBOM || numMultibyte > 3)?1.0:0.50;
+
         R_len_t numValid = 0;   // counts only valid UTF-8 multibyte seqs
         R_len_t numInvalid = 0;
 
@@ -571,10 +580,157 @@ SEXP stri_enc_isutf32le(SEXP str) {
 }
 
 
+/** Set up the sample of a string to be analysed by stri_enc_detect
+ *
+ * The sample consists of \code{nwindows} equally spaced windows,
+ * the first one starting at the beginning of the string and the last one
+ * ending at its end, with \code{sample_size} bytes in total.
+ * The windows start at offsets divisible by 4 so that UTF-16 and UTF-32
+ * code units are not split. If the whole string is to be analysed
+ * (\code{sample_size} is NA or not smaller than \code{str_n}),
+ * there is just one window.
+ *
+ * @param str_n number of bytes
+ * @param sample_size maximal number of bytes to analyse or NA_INTEGER
+ * @param nwindows number of windows, > 0
+ * @param windows [out] (start, length) pairs
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static void stri__enc_detect_windows(R_len_t str_n, int sample_size, int nwindows,
+    std::vector< std::pair<R_len_t, R_len_t> >& windows)
+{
+    windows.clear();
+    if (sample_size == NA_INTEGER || sample_size >= str_n) {
+        windows.push_back(std::pair<R_len_t, R_len_t>(0, str_n));
+        return;
+    }
+
+    R_len_t wsize = sample_size/nwindows;
+    if (nwindows <= 1 || wsize < 4) {
+        // a prefix
+        windows.push_back(std::pair<R_len_t, R_len_t>(0, sample_size));
+        return;
+    }
+
+    wsize -= wsize%4;
+    R_len_t last_end = 0;
+    for (int w=0; w<nwindows; ++w) {
+        R_len_t start = (R_len_t)(((double)w*(double)(str_n-wsize))/(double)(nwindows-1));
+        start -= start%4;
+        if (start < last_end) start = last_end; // ensure no overlaps
+        R_len_t len = min(wsize, str_n-start);
+        if (len <= 0) break;
+        windows.push_back(std::pair<R_len_t, R_len_t>(start, len));
+        last_end = start+len;
+    }
+}
+
+
+/** Get the key under which an encoding name is compared in stri_enc_detect
+ *
+ * @param name encoding name
+ * @return canonical (ICU) name or \code{name} if there is no such alias
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static std::string stri__enc_detect_name_key(const char* name)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const char* canonical = ucnv_getAlias(name, 0, &status);
+    if (U_FAILURE(status) || !canonical)
+        canonical = name;
+    return std::string(canonical);
+}
+
+
+/** Is an encoding among the selected ones?
+ *
+ * @param keys keys generated by stri__enc_detect_name_key; empty == all
+ * @param name encoding name
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__enc_detect_name_selected(const std::vector<std::string>& keys, const char* name)
+{
+    if (keys.empty()) return true;
+    if (!name) return false;
+    std::string key = stri__enc_detect_name_key(name);
+    for (size_t j=0; j<keys.size(); ++j) {
+        if (ucnv_compareNames(keys[j].c_str(), key.c_str()) == 0)
+            return true;
+    }
+    return false;
+}
+
+
+/** Run the charset detector on a text, see stri_enc_detect
+ *
+ * The matches are valid until the detector's next run.
+ *
+ * @param ucsdet detector
+ * @param text_s text
+ * @param text_n number of bytes in text_s
+ * @param keys candidate encodings, see stri__enc_detect_name_selected
+ * @param min_confidence NA or a threshold
+ * @param selected [out] the candidates, by decreasing confidence;
+ *    only one if it is at least as confident as min_confidence
+ * @return whether there is a candidate with confidence >= min_confidence
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__enc_detect_run(UCharsetDetector* ucsdet,
+    const char* text_s, R_len_t text_n, const std::vector<std::string>& keys,
+    double min_confidence, std::vector<const UCharsetMatch*>& selected)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    ucsdet_setText(ucsdet, text_s, text_n, &status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+    status = U_ZERO_ERROR;
+    int matchesFound;
+    const UCharsetMatch** match = ucsdet_detectAll(ucsdet, &matchesFound, &status);
+    if (U_FAILURE(status) || !match || matchesFound <= 0)
+        matchesFound = 0;
+
+    selected.clear();
+    for (R_len_t j=0; j<matchesFound; ++j) {
+        if (!keys.empty()) {
+            status = U_ZERO_ERROR;
+            const char* name = ucsdet_getName(match[j], &status);
+            if (U_FAILURE(status) || !stri__enc_detect_name_selected(keys, name))
+                continue;
+        }
+
+        if (!ISNA(min_confidence)) {
+            status = U_ZERO_ERROR;
+            int32_t conf = ucsdet_getConfidence(match[j], &status);
+            if (U_SUCCESS(status) && (double)(conf)/100.0 >= min_confidence) {
+                // the matches are sorted by decreasing confidence
+                selected.clear();
+                selected.push_back(match[j]);
+                return true;
+            }
+        }
+
+        selected.push_back(match[j]);
+    }
+    return false;
+}
+
+
 /** Detect encoding and language
  *
  * @param str character vector
  * @param filter_angle_brackets logical vector
+ * @param sample_size single integer or NA; maximal number of bytes to
+ *    analyse per string
+ * @param sample_windows single integer; number of windows over which
+ *    the sample is spread
+ * @param min_confidence single double or NA; if given, stop as soon as
+ *    a candidate with at least this confidence is found
+ * @param encodings NULL or character vector; candidate encodings
  *
  * @return list
  *
@@ -585,21 +741,68 @@ SEXP stri_enc_isutf32le(SEXP str) {
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    new args: sample_size, sample_windows, min_confidence, encodings
  */
-SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets)
+SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets,
+    SEXP sample_size, SEXP sample_windows, SEXP min_confidence, SEXP encodings)
 {
+    int sample_size_val = stri__prepare_arg_integer_1_NA(sample_size, "sample_size");
+    if (sample_size_val != NA_INTEGER && sample_size_val <= 0)
+        Rf_error(MSG__INCORRECT_NAMED_ARG "; " MSG__EXPECTED_POSITIVE, "sample_size");
+
+    int sample_windows_val = stri__prepare_arg_integer_1_notNA(sample_windows, "sample_windows");
+    if (sample_windows_val <= 0)
+        Rf_error(MSG__INCORRECT_NAMED_ARG "; " MSG__EXPECTED_POSITIVE, "sample_windows");
+
+    double min_confidence_val = stri__prepare_arg_double_1_NA(min_confidence, "min_confidence");
+    if (!ISNA(min_confidence_val) && (min_confidence_val < 0.0 || min_confidence_val > 1.0))
+        Rf_error(MSG__INCORRECT_NAMED_ARG "; " MSG__EXPECTED_PROBABILITY, "min_confidence");
+
     PROTECT(str = stri__prepare_arg_list_raw(str, "str"));
     PROTECT(filter_angle_brackets = stri__prepare_arg_logical(filter_angle_brackets, "filter_angle_brackets"));
+    if (!Rf_isNull(encodings))
+        encodings = stri__prepare_arg_string(encodings, "encodings");
+    PROTECT(encodings);
 
     UCharsetDetector* ucsdet = NULL;
 
 
-    STRI__ERROR_HANDLER_BEGIN(2)
+    STRI__ERROR_HANDLER_BEGIN(3)
 
     UErrorCode status = U_ZERO_ERROR;
     ucsdet = ucsdet_open(&status);
     STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
+    std::vector<std::string> encodings_keys; // empty == all
+    if (!Rf_isNull(encodings)) {
+        R_len_t encodings_n = LENGTH(encodings);
+        for (R_len_t j=0; j<encodings_n; ++j) {
+            if (STRING_ELT(encodings, j) == NA_STRING) continue;
+            encodings_keys.push_back(
+                stri__enc_detect_name_key(CHAR(STRING_ELT(encodings, j))));
+        }
+        if (encodings_keys.empty())
+            encodings_keys.push_back(std::string("\x01")); // nothing matches
+#ifndef U_HIDE_INTERNAL_API
+        // disable the recognisers that we are not interested in
+        UEnumeration* all = ucsdet_getAllDetectableCharsets(ucsdet, &status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        const char* name;
+        std::vector<std::string> all_names;
+        while ((name = uenum_next(all, NULL, &status)) != NULL && U_SUCCESS(status))
+            all_names.push_back(std::string(name));
+        uenum_close(all);
+        for (size_t j=0; j<all_names.size(); ++j) {
+            status = U_ZERO_ERROR;
+            ucsdet_setDetectableCharset(ucsdet, all_names[j].c_str(),
+                (UBool)stri__enc_detect_name_selected(encodings_keys, all_names[j].c_str()), &status);
+        }
+        status = U_ZERO_ERROR;
+#endif
+    }
+
     StriContainerListRaw str_cont(str);
     R_len_t str_n = str_cont.get_n();
 
@@ -620,6 +823,10 @@ SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets)
     SET_VECTOR_ELT(wrong, 2, stri__vector_NA_integers(1));
     Rf_setAttrib(wrong, R_NamesSymbol, names);
 
+    std::vector< std::pair<R_len_t, R_len_t> > windows;
+    std::vector<char> sample;
+    std::vector<const UCharsetMatch*> selected;
+
     StriContainerLogical filter(filter_angle_brackets, vectorize_length);
     for (R_len_t i=0; i<vectorize_length; ++i) {
         if (str_cont.isNA(i) || filter.isNA(i)) {
@@ -630,20 +837,44 @@ SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets)
         const char* str_cur_s = str_cont.get(i).c_str();
         R_len_t str_cur_n     = str_cont.get(i).length();
 
-        status = U_ZERO_ERROR;
-        ucsdet_setText(ucsdet, str_cur_s, str_cur_n, &status);
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         ucsdet_enableInputFilter(ucsdet, filter.get(i));
 
-        status = U_ZERO_ERROR;
-        int matchesFound;
-        const UCharsetMatch** match = ucsdet_detectAll(ucsdet, &matchesFound, &status);
-        if (U_FAILURE(status) || !match || matchesFound <= 0) {
+        stri__enc_detect_windows(str_cur_n, sample_size_val, sample_windows_val, windows);
+
+        // With min_confidence given, the windows are analysed one by one,
+        // each on its own: stop as soon as there is a candidate that is
+        // good enough. Otherwise (or if there is no such candidate),
+        // the whole sample is analysed at once.
+        selected.clear();
+        bool found = false;
+        if (windows.size() > 1 && !ISNA(min_confidence_val)) {
+            for (size_t w=0; !found && w<windows.size(); ++w)
+                found = stri__enc_detect_run(ucsdet,
+                    str_cur_s+windows[w].first, windows[w].second,
+                    encodings_keys, min_confidence_val, selected);
+        }
+
+        if (!found) {
+            const char* text_s = str_cur_s+windows[0].first;
+            R_len_t text_n = windows[0].second;
+            if (windows.size() > 1) {  // otherwise, a prefix or the whole string, no copying
+                sample.clear();
+                for (size_t w=0; w<windows.size(); ++w)
+                    sample.insert(sample.end(), str_cur_s+windows[w].first,
+                                  str_cur_s+windows[w].first+windows[w].second);
+                text_s = sample.data();
+                text_n = (R_len_t)sample.size();
+            }
+            stri__enc_detect_run(ucsdet, text_s, text_n,
+                encodings_keys, min_confidence_val, selected);
+        }
+
+        R_len_t matchesFound = (R_len_t)selected.size();
+        if (matchesFound <= 0) {
             SET_VECTOR_ELT(ret, i, wrong);
             continue;
         }
 
-
         SEXP val_enc, val_lang, val_conf;
         STRI__PROTECT(val_enc  = Rf_allocVector(STRSXP, matchesFound));
         STRI__PROTECT(val_lang = Rf_allocVector(STRSXP, matchesFound));
@@ -651,21 +882,21 @@ SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets)
 
         for (R_len_t j=0; j<matchesFound; ++j) {
             status = U_ZERO_ERROR;
-            const char* name = ucsdet_getName(match[j], &status);
+            const char* name = ucsdet_getName(selected[j], &status);
             if (U_FAILURE(status) || !name)
                 SET_STRING_ELT(val_enc, j, NA_STRING);
             else
                 SET_STRING_ELT(val_enc, j, Rf_mkChar(name));
 
             status = U_ZERO_ERROR;
-            int32_t conf = ucsdet_getConfidence(match[j], &status);
+            int32_t conf = ucsdet_getConfidence(selected[j], &status);
             if (U_FAILURE(status))
                 REAL(val_conf)[j] = NA_REAL;
             else
                 REAL(val_conf)[j] = (double)(conf)/100.0;
 
             status = U_ZERO_ERROR;
-            const char* lang = ucsdet_getLanguage(match[j], &status);
+            const char* lang = ucsdet_getLanguage(selected[j], &status);
             if (U_FAILURE(status) || !lang)
                 SET_STRING_ELT(val_lang, j, NA_STRING);
             else
@@ -805,6 +1036,119 @@ struct Converter8bit {
 // -----------------------------------------------------------------------
 
 
+/** Checks for UTF-32LE/BE, UTF-16LE/BE, ASCII, and 8-bit encodings
+ *  in a single pass; help struct for stri_enc_detect2  [DEPRECATED]
+ *
+ * The confidence values are the same as the ones determined by
+ * stri__enc_check_utf32le, stri__enc_check_utf32be (both with
+ * get_confidence=true), stri__enc_check_utf16le, stri__enc_check_utf16be,
+ * stri__enc_check_ascii (ditto), and stri__enc_check_8bit
+ * (get_confidence=false), but each byte is read only once.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+struct EncCheckFused {
+    double utf32le, utf32be, utf16le, utf16be, ascii, is8bit;
+
+    EncCheckFused(const char* str_cur_s, R_len_t str_cur_n)
+    {
+        bool check32 = (str_cur_n % 4 == 0);
+        bool check16 = (str_cur_n % 2 == 0);
+
+        bool has32LE_BOM = STRI__ENC_HAS_BOM_UTF32LE(str_cur_s, str_cur_n);
+        bool has32BE_BOM = STRI__ENC_HAS_BOM_UTF32BE(str_cur_s, str_cur_n);
+        bool has16LE_BOM = STRI__ENC_HAS_BOM_UTF16LE(str_cur_s, str_cur_n);
+        bool has16BE_BOM = STRI__ENC_HAS_BOM_UTF16BE(str_cur_s, str_cur_n);
+
+        // state: 0 = dead, 1 = alive, 2 = alive, expecting a trail surrogate
+        // [0] - big endian, [1] - little endian
+        int state16[2] = { (check16 && !has16LE_BOM)?1:0, (check16 && !has16BE_BOM)?1:0 };
+        R_len_t warn16[2] = {0, 0};
+
+        bool alive32[2] = { check32 && !has32LE_BOM, check32 && !has32BE_BOM };
+        R_len_t valid32[2] = {0, 0};
+        R_len_t invalid32[2] = {0, 0};
+
+        bool alive_ascii = true;
+        bool alive_8bit  = true;
+        R_len_t warn_ascii = 0;
+
+        for (R_len_t j=0; j<str_cur_n; ++j) {
+            uint8_t c = (uint8_t)str_cur_s[j];
+            if (c == 0)
+                alive_8bit = alive_ascii = false;
+            else if (c >= 128)
+                alive_ascii = false;
+            else if (c <= 31 || c == 127) {
+                if (c != 9 && c != 10 && c != 13 && c != 26)
+                    warn_ascii++;
+            }
+
+            if (j % 2 == 1 && (state16[0] | state16[1])) {
+                for (int le=0; le<2; ++le) {
+                    if (!state16[le]) continue;
+                    uint16_t u = le?
+                        STRI__GET_INT16_LE(str_cur_s, j-1):
+                        STRI__GET_INT16_BE(str_cur_s, j-1);
+                    if (state16[le] == 2) {
+                        state16[le] = U16_IS_SURROGATE_TRAIL(u)?1:0;
+                    }
+                    else if (U16_IS_SINGLE(u)) {
+                        if (u == 0)
+                            state16[le] = 0;
+                        else if (u >= 0x0530) // last cyrrilic supplement
+                            warn16[le] += 2;
+                    }
+                    else
+                        state16[le] = U16_IS_SURROGATE_LEAD(u)?2:0;
+                }
+            }
+
+            if (j % 4 == 3 && (alive32[0] || alive32[1])) {
+                for (int le=0; le<2; ++le) {
+                    int32_t ch = le?
+                        (int32_t)STRI__GET_INT32_LE(str_cur_s, j-3):
+                        (int32_t)STRI__GET_INT32_BE(str_cur_s, j-3);
+                    if (ch < 0 || ch >= 0x10FFFF || (ch >= 0xD800 && ch <= 0xDFFF))
+                        invalid32[le]++;
+                    else
+                        valid32[le]++;
+                }
+            }
+        }
+
+        is8bit = alive_8bit?1.0:0.0;
+        ascii  = alive_ascii?((double)(str_cur_n-warn_ascii)/double(str_cur_n)):0.0;
+        utf16be = (state16[0] == 1)?((double)(str_cur_n-warn16[0])/double(str_cur_n)):0.0;
+        utf16le = (state16[1] == 1)?((double)(str_cur_n-warn16[1])/double(str_cur_n)):0.0;
+        bool hasBOM32 = (has32LE_BOM || has32BE_BOM);
+        utf32be = alive32[0]?confidence32(hasBOM32, valid32[0], invalid32[0]):0.0;
+        utf32le = alive32[1]?confidence32(hasBOM32, valid32[1], invalid32[1]):0.0;
+    }
+
+    static double confidence32(bool hasBOM, R_len_t numValid, R_len_t numInvalid)
+    {
+        // as in stri__enc_check_utf32
+        if (hasBOM && numInvalid==0)
+            return 1.0;
+        else if (hasBOM && numValid > numInvalid*10)
+            return 0.80;
+        else if (numValid > 3 && numInvalid == 0)
+            return 1.0;
+        else if (numValid > 0 && numInvalid == 0)
+            return 0.80;
+        else if (numValid > numInvalid*10)
+            return 0.25;
+        else
+            return 0.0;
+    }
+};
+
+
+// -----------------------------------------------------------------------
+// -----------------------------------------------------------------------
+
+
 /** Guesses text encoding; help struct for stri_enc_detect2  [DEPRECATED]
  *
  * @version 0.1-?? (Marek Gagolewski)
@@ -834,11 +1178,11 @@ struct EncGuess {
     }
 
     static void do_utf32(vector<EncGuess>& guesses, const char* str_cur_s,
-                         R_len_t str_cur_n)
+                         R_len_t str_cur_n, const EncCheckFused& checks)
     {
         /* check UTF-32LE, UTF-32BE or UTF-32+BOM */
-        double isutf32le = stri__enc_check_utf32le(str_cur_s, str_cur_n, true);
-        double isutf32be = stri__enc_check_utf32be(str_cur_s, str_cur_n, true);
+        double isutf32le = checks.utf32le;
+        double isutf32be = checks.utf32be;
         if (isutf32le >= 0.25 && isutf32be >= 0.25) {
             // no BOM, both valid
             // i think this will never happen
@@ -860,11 +1204,11 @@ struct EncGuess {
     }
 
     static void do_utf16(vector<EncGuess>& guesses, const char* str_cur_s,
-                         R_len_t str_cur_n)
+                         R_len_t str_cur_n, const EncCheckFused& checks)
     {
         /* check UTF-16LE, UTF-16BE or UTF-16+BOM */
-        double isutf16le = stri__enc_check_utf16le(str_cur_s, str_cur_n, true);
-        double isutf16be = stri__enc_check_utf16be(str_cur_s, str_cur_n, true);
+        double isutf16le = checks.utf16le;
+        double isutf16be = checks.utf16be;
         if (isutf16le >= 0.25 && isutf16be >= 0.25) {
             // no BOM, both valid
             // this may sometimes happen
@@ -886,12 +1230,12 @@ struct EncGuess {
     }
 
     static void do_8bit(vector<EncGuess>& guesses, const char* str_cur_s,
-                        R_len_t str_cur_n, const char* qloc)
+                        R_len_t str_cur_n, const char* qloc, const EncCheckFused& checks)
     {
-        double is8bit = stri__enc_check_8bit(str_cur_s, str_cur_n, false);
+        double is8bit = checks.is8bit;
         if (is8bit != 0.0) {
             // may be an 8-bit encoding
-            double isascii = stri__enc_check_ascii(str_cur_s, str_cur_n, true);
+            double isascii = checks.ascii;
             if (isascii >= 0.25) // i.e., equal to 1.0 => nothing more to check
                 guesses.push_back(EncGuess("US-ASCII", "US-ASCII", isascii));
             else {
@@ -1004,6 +1348,9 @@ struct EncGuess {
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    use EncCheckFused
  */
 SEXP stri_enc_detect2(SEXP str, SEXP loc)
 {
@@ -1047,9 +1394,10 @@ SEXP stri_enc_detect2(SEXP str, SEXP loc)
         vector<EncGuess> guesses;
         guesses.reserve(6);
 
-        EncGuess::do_utf32(guesses, str_cur_s, str_cur_n);
-        EncGuess::do_utf16(guesses, str_cur_s, str_cur_n);
-        EncGuess::do_8bit(guesses, str_cur_s, str_cur_n, qloc);  // includes UTF-8
+        EncCheckFused checks(str_cur_s, str_cur_n);  // all but UTF-8 at once
+        EncGuess::do_utf32(guesses, str_cur_s, str_cur_n, checks);
+        EncGuess::do_utf16(guesses, str_cur_s, str_cur_n, checks);
+        EncGuess::do_8bit(guesses, str_cur_s, str_cur_n, qloc, checks);  // includes UTF-8
 
         R_len_t matchesFound = (R_len_t)guesses.size();
         if (matchesFound <= 0) {
@@ -69,6 +69,10 @@ using namespace std;
    PROTECT(s);                                                \
    ++__stri_protected_sexp_num; }
 
+#define STRI__PROTECT_WITH_INDEX(s, pi) {                     \
+   PROTECT_WITH_INDEX(s, pi);                                 \
+   ++__stri_protected_sexp_num; }
+
 #ifndef NDEBUG
 #define STRI__UNPROTECT(n) {                                  \
    UNPROTECT(n);                                              \
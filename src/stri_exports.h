@@ -53,7 +53,7 @@ SEXP stri_sort(SEXP str, SEXP decreasing=Rf_ScalarLogical(FALSE),
 SEXP stri_rank(SEXP str, SEXP opts_collator=R_NilValue);
 SEXP stri_order(SEXP str, SEXP decreasing=Rf_ScalarLogical(FALSE),
     SEXP na_last=Rf_ScalarLogical(TRUE), SEXP opts_collator=R_NilValue);
-SEXP stri_sort_key(SEXP str, SEXP opts_collator=R_NilValue);
+SEXP stri_sort_key(SEXP str, SEXP opts_collator=R_NilValue, SEXP packed=Rf_ScalarLogical(FALSE));
 
 SEXP stri_unique(SEXP str, SEXP opts_collator=R_NilValue);
 SEXP stri_duplicated(SEXP str, SEXP fromLast=Rf_ScalarLogical(FALSE),
@@ -64,6 +64,18 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast=Rf_ScalarLogical(FALSE),
 // ICU_settings.cpp:
 SEXP stri_info();
 
+// options.cpp:
+SEXP stri_options_get();
+SEXP stri_options_set(SEXP opts);
+SEXP stri_cache_info(SEXP reset);
+
+// files.cpp:
+SEXP stri_read_lines_open(SEXP fname, SEXP encoding);
+SEXP stri_read_lines_next(SEXP reader, SEXP n_max, SEXP skip);
+SEXP stri_read_lines_close(SEXP reader);
+SEXP stri_read_raw(SEXP fname);
+SEXP stri_write_lines(SEXP str, SEXP fname, SEXP encoding, SEXP sep);
+
 // escape.cpp
 SEXP stri_escape_unicode(SEXP str);
 SEXP stri_unescape_unicode(SEXP str);
@@ -138,7 +150,9 @@ SEXP stri_enc_toascii(SEXP str);
 
 // encoding_detection.cpp:
 SEXP stri_enc_detect2(SEXP str, SEXP loc=R_NilValue);
-SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets=Rf_ScalarLogical(FALSE));
+SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets=Rf_ScalarLogical(FALSE),
+    SEXP sample_size=Rf_ScalarInteger(NA_INTEGER), SEXP sample_windows=Rf_ScalarInteger(1),
+    SEXP min_confidence=Rf_ScalarReal(NA_REAL), SEXP encodings=R_NilValue);
 SEXP stri_enc_isascii(SEXP str);
 SEXP stri_enc_isutf8(SEXP str);
 SEXP stri_enc_isutf16le(SEXP str);
@@ -450,4 +464,16 @@ SEXP stri_test_UnicodeContainer16b(SEXP str);
 SEXP stri_test_UnicodeContainer8(SEXP str);
 SEXP stri_test_returnasis(SEXP x);
 
+// brkiter_ascii.cpp /* internal, but in namespace: for testing */
+SEXP stri_test_brkiter_ascii(SEXP str, SEXP type);
+
+// time_calendar.cpp /* internal, but in namespace: for testing */
+SEXP stri_test_datetime_grego(SEXP tz);
+
+// time_format.cpp /* internal, but in namespace: for testing */
+SEXP stri_test_datetime_iso(SEXP time, SEXP str, SEXP format, SEXP tz, SEXP locale);
+
+// encoding_conversion.cpp /* internal, but in namespace: for testing */
+SEXP stri_test_encode_kernels(SEXP str, SEXP from, SEXP to);
+
 #endif
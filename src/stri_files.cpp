@@ -0,0 +1,921 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_container_utf8.h"
+#include "stri_ucnv.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#if !defined(_WIN32) && !defined(STRI_DISABLE_MMAP)
+#define STRI__FILES_MMAP 1
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+
+/* size of the chunks read from files (in bytes) */
+#define STRI__FILES_CHUNK_SIZE 1048576
+
+/* size of the output buffer of StriLineWriter (in bytes) */
+#define STRI__FILES_OUTBUF_SIZE 1048576
+
+/* initial capacity of the output character vectors */
+#define STRI__FILES_LINES_INIT 1024
+
+
+/** Get the name of a file to be opened with stri__fopen
+ *
+ * Use before STRI__ERROR_HANDLER_BEGIN: the translation may call Rf_error.
+ *
+ * @param fname CHARSXP, not NA
+ * @return file name in UTF-8 on Windows, in the native encoding elsewhere
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static const char* stri__prepare_fname(SEXP fname)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return Rf_translateCharUTF8(fname);
+#else
+    return Rf_translateChar(fname);
+#endif
+}
+
+
+/** Open a file
+ *
+ * On Windows, \code{fopen} expects the file names in the ANSI code page,
+ * which cannot represent all the characters; hence, the UTF-8 names
+ * are converted to UTF-16 and passed to \code{_wfopen}.
+ *
+ * @param fname file name, see stri__prepare_fname
+ * @param mode \code{"rb"} or \code{"wb"}
+ * @return file handle or NULL on error
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static FILE* stri__fopen(const char* fname, const char* mode)
+{
+    // only a leading tilde is replaced, other bytes are left as-is
+    const char* fname_exp = R_ExpandFileName(fname);
+#if defined(_WIN32) || defined(_WIN64)
+    UnicodeString fname_w = UnicodeString::fromUTF8(fname_exp);
+    UnicodeString mode_w = UnicodeString::fromUTF8(mode);
+    return _wfopen((const wchar_t*)fname_w.getTerminatedBuffer(),
+                   (const wchar_t*)mode_w.getTerminatedBuffer());
+#else
+    return fopen(fname_exp, mode);
+#endif
+}
+
+
+/**
+ * Sequential access to the contents of a file
+ *
+ * Regular files are memory-mapped (where supported), so that
+ * their contents can be accessed directly, without copying.
+ * Other files (e.g., pipes) or if mmap fails, buffered reads are used.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriFileInput {
+
+private:
+
+    std::string fname;       ///< file name (as given)
+    FILE* f;
+    const char* map;         ///< mapped contents or NULL
+    size_t map_n;            ///< size of the mapping
+    size_t map_pos;          ///< current position in the mapping
+    std::vector<char> buf;   ///< buffer for the non-mapped case
+    std::string peeked;      ///< bytes already consumed by isCompressed
+
+
+public:
+
+    StriFileInput(const char* _fname)
+        : fname(_fname)
+    {
+        map = NULL;
+        map_n = 0;
+        map_pos = 0;
+
+        f = stri__fopen(_fname, "rb");
+        if (!f)
+            throw StriException(MSG__FILE_OPEN_ERROR, _fname);
+
+#ifdef STRI__FILES_MMAP
+        struct stat st;
+        if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) &&
+                st.st_size > 0 && (uintmax_t)st.st_size <= (uintmax_t)SIZE_MAX) {
+            void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+            if (p != MAP_FAILED) {
+                map = (const char*)p;
+                map_n = (size_t)st.st_size;
+                posix_madvise(p, map_n, POSIX_MADV_SEQUENTIAL);
+            }
+        }
+#endif
+    }
+
+
+    ~StriFileInput()
+    {
+#ifdef STRI__FILES_MMAP
+        if (map) munmap((void*)map, map_n);
+#endif
+        if (f) fclose(f);
+    }
+
+
+    const char* getFileName() const { return fname.c_str(); }
+
+    /** Is the file memory-mapped? */
+    bool isMapped() const { return map != NULL; }
+
+    /** The whole contents of a mapped file */
+    const char* getMappedData() const { return map; }
+
+    /** The size of a mapped file */
+    size_t getMappedSize() const { return map_n; }
+
+
+    /** Size of a regular file, or -1 if unknown */
+    double getSize()
+    {
+        if (map) return (double)map_n;
+#ifdef STRI__FILES_MMAP
+        struct stat st;
+        if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode))
+            return (double)st.st_size;
+#endif
+        return -1.0;
+    }
+
+
+    /** Move the current position to a given offset of a mapped file */
+    void seekMapped(size_t pos) { map_pos = pos; }
+
+
+    /** Get the next chunk of data
+     *
+     * @param data [out] pointer to the data (valid until the next call)
+     * @param maxn maximal number of bytes to get
+     * @return number of bytes; less than maxn at the end of the file
+     */
+    size_t read(const char*& data, size_t maxn)
+    {
+        if (map) {
+            size_t n = std::min(maxn, map_n-map_pos);
+            data = map+map_pos;
+            map_pos += n;
+            return n;
+        }
+
+        if (buf.size() < maxn) buf.resize(maxn);
+        size_t n = std::min(maxn, peeked.size());
+        memcpy(buf.data(), peeked.data(), n);
+        peeked.erase(0, n);
+        n += fread(buf.data()+n, 1, maxn-n, f);
+        if (ferror(f))
+            throw StriException(MSG__FILE_READ_ERROR, fname.c_str());
+        data = buf.data();
+        return n;
+    }
+
+
+    /** Is the file compressed (gzip, bzip2, xz)?
+     *
+     * Such files are decompressed transparently by R's \code{file()},
+     * but not here; to be called before \code{read}.
+     * Pipes cannot be rewound, hence the bytes inspected are kept.
+     */
+    bool isCompressed()
+    {
+        unsigned char magic[6];
+        size_t n;
+        if (map) {
+            n = std::min((size_t)6, map_n);
+            memcpy(magic, map, n);
+        }
+        else {
+            n = fread(magic, 1, 6, f);
+            peeked.assign((const char*)magic, n);
+        }
+        return (n >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) ||
+               (n >= 3 && magic[0] == 'B' && magic[1] == 'Z' && magic[2] == 'h') ||
+               (n >= 6 && magic[0] == 0xFD && !memcmp(magic+1, "7zXZ", 4) && magic[5] == 0x00);
+    }
+};
+
+
+/**
+ * Reads a text file chunk by chunk, converts it to UTF-8, and splits it
+ * into text lines; used by stri_read_lines
+ *
+ * Only a single chunk of the input and the current (incomplete) line are
+ * held in memory. Multibyte sequences split across chunk boundaries
+ * are dealt with by the streaming ICU converter (or, in the case of UTF-8
+ * input, by carrying over the incomplete sequence to the next chunk).
+ *
+ * Memory-mapped UTF-8 files are processed in place: they are validated
+ * chunk by chunk and the lines point directly to the mapped data; in case
+ * of an ill-formed sequence, we switch to the general (copying) mode.
+ *
+ * Text lines are split in the same way as in \code{stri_split_lines1}.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriLineReader {
+
+private:
+
+    std::string encname;   ///< encoding name; StriUcnv does not own it
+    StriFileInput in;
+    StriUcnv ucnv;         ///< source converter, with warning callbacks
+    UConverter* ucnv_utf8; ///< target converter
+    bool passthrough;      ///< is the input encoded in UTF-8?
+    bool direct;           ///< process a mapped UTF-8 file in place?
+    size_t chunk_size;     ///< number of bytes to read/validate at a time
+
+    std::vector<UChar> pivot;    ///< ucnv_convertEx pivot buffer
+    UChar* pivot_source;
+    UChar* pivot_target;
+    bool reset;                  ///< next ucnv_convertEx is the first one
+
+    std::string carry;    ///< incomplete UTF-8 sequence (passthrough mode)
+    std::string text;     ///< converted text (unless direct)
+    const char* tdata;    ///< text.data() or the mapped data (if direct)
+    size_t tn;            ///< the size of text or the validated part of the mapping
+    size_t pos;           ///< start of the unprocessed part of text
+    bool first;           ///< at the beginning of the text (BOM removal)
+    bool eof;             ///< whole input has been converted
+    bool done;            ///< all lines have been returned
+    double nlines;        ///< number of lines returned/skipped so far
+
+
+    /** Append [s, s+n) (in the source encoding) to text, converting to UTF-8
+     *
+     * @param s input bytes
+     * @param n number of bytes
+     * @param flush is this the last chunk of the input?
+     */
+    void convert(const char* s, size_t n, bool flush)
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        const char* source = s;
+        const char* sourceLimit = s+n;
+        char buf[65536];
+        do {
+            status = U_ZERO_ERROR;
+            char* target = buf;
+            ucnv_convertEx(ucnv_utf8, ucnv.getConverter(true),
+                           &target, buf+sizeof(buf), &source, sourceLimit,
+                           pivot.data(), &pivot_source, &pivot_target,
+                           pivot.data()+pivot.size(), (UBool)reset, (UBool)flush,
+                           &status);
+            reset = false;
+            text.append(buf, target-buf);
+        } while (status == U_BUFFER_OVERFLOW_ERROR);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    }
+
+
+    /** Get the length of the longest prefix of [s, s+n) that does not end
+     *  with an incomplete UTF-8 sequence
+     */
+    static size_t utf8_cut(const char* s, size_t n)
+    {
+        // find the last byte that may start a sequence
+        size_t k = n;
+        while (k > 0 && n-k < 4 && U8_IS_TRAIL((uint8_t)s[k-1]))
+            --k;
+        if (k > 0 && n-k < 4 && U8_IS_LEAD((uint8_t)s[k-1]) &&
+                (size_t)U8_COUNT_TRAIL_BYTES((uint8_t)s[k-1]) > n-k)
+            return k-1;
+        return n;
+    }
+
+
+    /** Append [s, s+n) (in UTF-8) to text; well-formed text is copied as-is
+     *
+     * @param s input bytes
+     * @param n number of bytes
+     * @param flush is this the last chunk of the input?
+     */
+    void convert_utf8(const char* s, size_t n, bool flush)
+    {
+        if (!carry.empty()) {
+            carry.append(s, n);
+            std::string tmp;
+            tmp.swap(carry);
+            convert_utf8(tmp.data(), tmp.size(), flush);
+            return;
+        }
+
+        size_t cut = n;
+        if (!flush) {
+            // an incomplete sequence at the end is passed to the next chunk
+            cut = utf8_cut(s, n);
+            carry.assign(s+cut, n-cut);
+        }
+
+        if (cut > INT_MAX || stri__utf8_invalid_offset(s, (R_len_t)cut) >= 0) {
+            // let ICU substitute (and warn about) ill-formed sequences;
+            // cut is at a sequence boundary, so no converter state is lost
+            convert(s, cut, true);
+            reset = true;
+        }
+        else
+            text.append(s, cut);
+    }
+
+
+    /** Validate the next chunk of a mapped UTF-8 file (direct mode) */
+    void read_chunk_direct()
+    {
+        size_t map_n = in.getMappedSize();
+        size_t n = std::min(chunk_size, map_n-tn);
+        bool flush = (tn+n >= map_n);
+        size_t cut = flush?n:utf8_cut(tdata+tn, n);
+        if (cut == 0 && !flush) cut = n;  // no lead byte at all: ill-formed
+
+        if (cut <= INT_MAX && stri__utf8_invalid_offset(tdata+tn, (R_len_t)cut) < 0) {
+            tn += cut;
+            if (tn >= map_n) eof = true;
+            return;
+        }
+
+        // switch to the general mode: copy the incomplete line
+        // and continue from the beginning of this chunk
+        direct = false;
+        text.assign(tdata+pos, tn-pos);
+        in.seekMapped(tn);
+        pos = 0;
+        tdata = text.data();
+        tn = text.size();
+        read_chunk();
+    }
+
+
+    /** Read the next chunk of the input */
+    void read_chunk()
+    {
+        if (direct) {
+            read_chunk_direct();
+        }
+        else {
+            const char* data;
+            size_t n = in.read(data, chunk_size);
+            bool flush = (n < chunk_size);
+
+            if (passthrough)
+                convert_utf8(data, n, flush);
+            else
+                convert(data, n, flush);
+
+            if (flush) eof = true;
+
+            tdata = text.data();
+            tn = text.size();
+        }
+
+        if (first && (tn >= 3 || eof)) {
+            if (STRI__ENC_HAS_BOM_UTF8(tdata, (R_len_t)tn))
+                pos = 3;
+            first = false;
+        }
+    }
+
+
+    /** Find the next text line in tdata[pos...]
+     *
+     * @param line_start [out]
+     * @param line_end [out]
+     * @return false if more input is needed to determine the line
+     */
+    bool find_line(size_t& line_start, size_t& line_end)
+    {
+        const uint8_t* s = (const uint8_t*)tdata;
+        size_t n = tn;
+        for (size_t j = pos; j < n; ++j) {
+            uint8_t c = s[j];
+            size_t seplen = 0;
+            if (c > ASCII_CR && c != 0xC2 && c != 0xE2)
+                continue;  // the most common case
+            else if (c >= ASCII_LF && c <= ASCII_CR) {
+                seplen = 1;
+                if (c == ASCII_CR) {
+                    if (j+1 >= n && !eof) return false;  // is LF next?
+                    if (j+1 < n && s[j+1] == ASCII_LF) seplen = 2;
+                }
+            }
+            else if (c == 0xC2) {  // NEL = C2 85
+                if (j+1 >= n && !eof) return false;
+                if (j+1 < n && s[j+1] == 0x85) seplen = 2;
+            }
+            else if (c == 0xE2) {  // LS = E2 80 A8, PS = E2 80 A9
+                if (j+2 >= n && !eof) return false;
+                if (j+2 < n && s[j+1] == 0x80 && (s[j+2] == 0xA8 || s[j+2] == 0xA9))
+                    seplen = 3;
+            }
+
+            if (seplen > 0) {
+                line_start = pos;
+                line_end = j;
+                pos = j+seplen;
+                return true;
+            }
+        }
+
+        if (!eof) return false;
+
+        // the last line; stri_split_lines1 does not output an empty string
+        // after the trailing newline, unless the text is empty
+        line_start = pos;
+        line_end = n;
+        pos = n;
+        done = true;
+        return (line_end > line_start || nlines == 0);
+    }
+
+
+public:
+
+    StriLineReader(const char* _fname, const char* _encname)
+        : encname(_encname?_encname:""), in(_fname),
+          ucnv(_encname?encname.c_str():NULL), pivot(32768)
+    {
+        ucnv_utf8 = NULL;
+        chunk_size = STRI__FILES_CHUNK_SIZE;
+        pivot_source = pivot_target = pivot.data();
+        reset = true;
+        tdata = text.data();
+        tn = 0;
+        pos = 0;
+        first = true;
+        eof = false;
+        done = false;
+        nlines = 0;
+
+        ucnv.getConverter(true /*register_callbacks*/);
+        passthrough = ucnv.isUTF8();  // ICU is only needed for ill-formed input
+        direct = passthrough && in.isMapped();
+        if (direct)
+            tdata = in.getMappedData();
+
+        UErrorCode status = U_ZERO_ERROR;
+        ucnv_utf8 = ucnv_open("UTF-8", &status);
+        STRI__CHECKICUSTATUS_THROW(status, { ucnv_utf8 = NULL; })
+    }
+
+
+    ~StriLineReader()
+    {
+        if (ucnv_utf8) ucnv_close(ucnv_utf8);
+    }
+
+
+    /** Is the file compressed? See StriFileInput::isCompressed */
+    bool isCompressed() { return in.isCompressed(); }
+
+
+    /** Get the next text line
+     *
+     * @param line [out] pointer to the line's contents
+     *  (valid until the next call)
+     * @param line_n [out] number of bytes
+     * @return false if there are no more lines
+     */
+    bool next(const char*& line, size_t& line_n)
+    {
+        while (!done) {
+            size_t line_start, line_end;
+            if (find_line(line_start, line_end)) {
+                line = tdata+line_start;
+                line_n = line_end-line_start;
+                nlines += 1;
+                return true;
+            }
+
+            if (eof) break;  // done
+
+            if (!direct) {
+                // drop the processed part; keep the incomplete line
+                text.erase(0, pos);
+                pos = 0;
+            }
+            read_chunk();
+        }
+        return false;
+    }
+};
+
+
+/** Finalizer for the external pointer holding a StriLineReader
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static void stri__read_lines_finalize(SEXP reader)
+{
+    StriLineReader* r = (StriLineReader*)R_ExternalPtrAddr(reader);
+    if (r) {
+        delete r;
+        R_ClearExternalPtr(reader);
+    }
+}
+
+
+/** Open a text file for reading by stri_read_lines_next
+ *
+ * @param fname single string, file name
+ * @param encoding single string or NULL, input encoding
+ * @return an external pointer or NULL if the file is compressed
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_read_lines_open(SEXP fname, SEXP encoding)
+{
+    const char* enc = stri__prepare_arg_enc(encoding, "encoding", true); /* this is R_alloc'ed */
+    PROTECT(fname = stri__prepare_arg_string_1(fname, "con"));
+    if (STRING_ELT(fname, 0) == NA_STRING) {
+        UNPROTECT(1);
+        Rf_error(MSG__ARG_EXPECTED_NOT_NA, "con"); // allowed here
+    }
+    const char* fname_s = stri__prepare_fname(STRING_ELT(fname, 0));
+
+    StriLineReader* r = NULL;
+    STRI__ERROR_HANDLER_BEGIN(1)
+    r = new StriLineReader(fname_s, enc);
+    if (r->isCompressed()) {
+        delete r;
+        STRI__UNPROTECT_ALL
+        return R_NilValue;
+    }
+    SEXP ret;
+    STRI__PROTECT(ret = R_MakeExternalPtr((void*)r, R_NilValue, R_NilValue));
+    R_RegisterCFinalizerEx(ret, stri__read_lines_finalize, TRUE);
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END(if (r) delete r;)
+}
+
+
+/** Read the next text lines from a file opened with stri_read_lines_open
+ *
+ * @param reader external pointer
+ * @param n_max single integer, maximal number of lines to read;
+ *        negative for all
+ * @param skip single integer, number of lines to skip first
+ * @return character vector (in UTF-8); empty if there are no more lines
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_read_lines_next(SEXP reader, SEXP n_max, SEXP skip)
+{
+    double n_max_cur = stri__prepare_arg_double_1_notNA(n_max, "n_max");
+    double skip_cur  = stri__prepare_arg_double_1_notNA(skip, "skip");
+    // whole numbers only, e.g., 0 < n_max < 1 would yield an empty buffer
+    if (n_max_cur != floor(n_max_cur))
+        Rf_error(MSG__INCORRECT_NAMED_ARG, "n_max"); // allowed here
+    if (skip_cur != floor(skip_cur))
+        Rf_error(MSG__INCORRECT_NAMED_ARG, "skip"); // allowed here
+    if (TYPEOF(reader) != EXTPTRSXP || !R_ExternalPtrAddr(reader))
+        Rf_error(MSG__INCORRECT_INTERNAL_ARG); // allowed here
+    StriLineReader* r = (StriLineReader*)R_ExternalPtrAddr(reader);
+
+    STRI__ERROR_HANDLER_BEGIN(0)
+    const char* line;
+    size_t line_n;
+    for (double j = 0; j < skip_cur && r->next(line, line_n); ++j)
+        ; // skip
+
+    R_xlen_t capacity = STRI__FILES_LINES_INIT;
+    if (n_max_cur >= 0 && n_max_cur < capacity) capacity = (R_xlen_t)n_max_cur;
+    SEXP ret;
+    PROTECT_INDEX ret_index;
+    STRI__PROTECT_WITH_INDEX(ret = Rf_allocVector(STRSXP, capacity), &ret_index);
+
+    R_xlen_t k = 0;
+    while ((n_max_cur < 0 || k < n_max_cur) && r->next(line, line_n)) {
+        if (line_n > (size_t)INT_MAX)
+            throw StriException(MSG__CHARSXP_2147483647);
+        if (memchr(line, 0, line_n))
+            throw StriException(MSG__EMBEDDED_NUL);
+
+        if (k >= capacity) {
+            capacity = std::max((R_xlen_t)1, 2*capacity);
+            REPROTECT(ret = Rf_xlengthgets(ret, capacity), ret_index);
+        }
+        SET_STRING_ELT(ret, k++, Rf_mkCharLenCE(line, (int)line_n, CE_UTF8));
+    }
+
+    if (k < capacity)
+        REPROTECT(ret = Rf_xlengthgets(ret, k), ret_index);
+
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END({/* no special action on error */})
+}
+
+
+/** Close a file opened with stri_read_lines_open
+ *
+ * @param reader external pointer
+ * @return R_NilValue
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_read_lines_close(SEXP reader)
+{
+    if (TYPEOF(reader) == EXTPTRSXP)
+        stri__read_lines_finalize(reader);
+    return R_NilValue;
+}
+
+
+/** Read a file as-is
+ *
+ * Regular files are memory-mapped and copied directly to the output
+ * raw vector, otherwise the file is read in chunks.
+ *
+ * @param fname single string, file name
+ * @return raw vector or NULL if the file is compressed
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_read_raw(SEXP fname)
+{
+    PROTECT(fname = stri__prepare_arg_string_1(fname, "con"));
+    if (STRING_ELT(fname, 0) == NA_STRING) {
+        UNPROTECT(1);
+        Rf_error(MSG__ARG_EXPECTED_NOT_NA, "con"); // allowed here
+    }
+    const char* fname_s = stri__prepare_fname(STRING_ELT(fname, 0));
+
+    STRI__ERROR_HANDLER_BEGIN(1)
+    StriFileInput in(fname_s);
+    if (in.isCompressed()) {
+        STRI__UNPROTECT_ALL
+        return R_NilValue;
+    }
+
+    SEXP ret;
+    if (in.isMapped()) {
+        STRI__PROTECT(ret = Rf_allocVector(RAWSXP, (R_xlen_t)in.getMappedSize()));
+        memcpy(RAW(ret), in.getMappedData(), in.getMappedSize());
+    }
+    else {
+        // the size of a regular file is a good guess; 0 for pipes etc.
+        double size = in.getSize();
+        R_xlen_t capacity = (size > 0) ? (R_xlen_t)size : (R_xlen_t)STRI__FILES_CHUNK_SIZE;
+        PROTECT_INDEX ret_index;
+        STRI__PROTECT_WITH_INDEX(ret = Rf_allocVector(RAWSXP, capacity), &ret_index);
+
+        R_xlen_t k = 0;
+        while (true) {
+            const char* data;
+            size_t n = in.read(data, STRI__FILES_CHUNK_SIZE);
+            if (n == 0) break;
+            if (k+(R_xlen_t)n > capacity) {
+                capacity = std::max(2*capacity, k+(R_xlen_t)n);
+                REPROTECT(ret = Rf_xlengthgets(ret, capacity), ret_index);
+            }
+            memcpy(RAW(ret)+k, data, n);
+            k += (R_xlen_t)n;
+        }
+
+        if (k < capacity)
+            REPROTECT(ret = Rf_xlengthgets(ret, k), ret_index);
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END({/* no special action on error */})
+}
+
+
+/**
+ * Writes UTF-8 strings to a file, converting them to a given encoding;
+ * used by stri_write_lines
+ *
+ * Uses a fixed-size output buffer and a single converter, whose state
+ * is kept across the consecutive calls to \code{write}.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriLineWriter {
+
+private:
+
+    const char* fname;
+    FILE* f;
+    StriUcnv ucnv;          ///< target converter, with warning callbacks
+    UConverter* ucnv_utf8;  ///< source converter
+    bool passthrough;       ///< is the output encoded in UTF-8?
+
+    std::vector<char> outbuf;
+    size_t outbuf_n;             ///< number of bytes used
+    std::vector<UChar> pivot;    ///< ucnv_convertEx pivot buffer
+    UChar* pivot_source;
+    UChar* pivot_target;
+    bool reset;                  ///< next ucnv_convertEx is the first one
+
+
+    /** Write the contents of the output buffer to the file */
+    void flush_outbuf()
+    {
+        if (outbuf_n > 0 && fwrite(outbuf.data(), 1, outbuf_n, f) != outbuf_n)
+            throw StriException(MSG__FILE_WRITE_ERROR, fname);
+        outbuf_n = 0;
+    }
+
+
+    /** Convert [s, s+n) from UTF-8 to the target encoding; buffered
+     *
+     * @param s input bytes
+     * @param n number of bytes
+     * @param flush is this the last chunk of the output?
+     */
+    void convert(const char* s, size_t n, bool flush)
+    {
+        UErrorCode status;
+        const char* source = s;
+        const char* sourceLimit = s+n;
+        do {
+            status = U_ZERO_ERROR;
+            char* target = outbuf.data()+outbuf_n;
+            ucnv_convertEx(ucnv.getConverter(true), ucnv_utf8,
+                           &target, outbuf.data()+outbuf.size(), &source, sourceLimit,
+                           pivot.data(), &pivot_source, &pivot_target,
+                           pivot.data()+pivot.size(), (UBool)reset, (UBool)flush,
+                           &status);
+            reset = false;
+            outbuf_n = target-outbuf.data();
+            if (status == U_BUFFER_OVERFLOW_ERROR)
+                flush_outbuf();
+        } while (status == U_BUFFER_OVERFLOW_ERROR);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    }
+
+
+public:
+
+    StriLineWriter(const char* _fname, const char* _encname)
+        : fname(_fname), ucnv(_encname), outbuf(STRI__FILES_OUTBUF_SIZE), pivot(32768)
+    {
+        f = NULL;
+        outbuf_n = 0;
+        pivot_source = pivot_target = pivot.data();
+        reset = true;
+
+        ucnv.getConverter(true /*register_callbacks*/);
+        passthrough = ucnv.isUTF8();  // ICU is only needed for ill-formed input
+
+        UErrorCode status = U_ZERO_ERROR;
+        ucnv_utf8 = ucnv_open("UTF-8", &status);
+        STRI__CHECKICUSTATUS_THROW(status, { ucnv_utf8 = NULL; })
+
+        f = stri__fopen(_fname, "wb");
+        if (!f) {
+            ucnv_close(ucnv_utf8);
+            throw StriException(MSG__FILE_OPEN_ERROR, _fname);
+        }
+    }
+
+
+    ~StriLineWriter()
+    {
+        if (f) fclose(f);
+        if (ucnv_utf8) ucnv_close(ucnv_utf8);
+    }
+
+
+    /** Write a UTF-8 string
+     *
+     * @param s string
+     * @param n number of bytes
+     */
+    void write(const char* s, size_t n)
+    {
+        if (passthrough && stri__utf8_invalid_offset(s, (R_len_t)n) < 0) {
+            // zero-conversion path
+            if (outbuf_n+n > outbuf.size()) {
+                flush_outbuf();
+                if (n > outbuf.size()) {
+                    if (fwrite(s, 1, n, f) != n)
+                        throw StriException(MSG__FILE_WRITE_ERROR, fname);
+                    return;
+                }
+            }
+            memcpy(outbuf.data()+outbuf_n, s, n);
+            outbuf_n += n;
+        }
+        else if (passthrough) {
+            // let ICU substitute (and warn about) ill-formed sequences
+            convert(s, n, true);
+            reset = true;
+        }
+        else
+            convert(s, n, false);
+    }
+
+
+    /** Flush the converter and the buffer, and close the file */
+    void close()
+    {
+        if (!passthrough)
+            convert("", 0, true);
+        flush_outbuf();
+        int ret = fclose(f);
+        f = NULL;
+        if (ret != 0)
+            throw StriException(MSG__FILE_WRITE_ERROR, fname);
+    }
+};
+
+
+/** Write text lines to a file
+ *
+ * @param str character vector
+ * @param fname single string, file name
+ * @param encoding single string or NULL, output encoding
+ * @param sep single string, line separator
+ * @return R_NilValue
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_write_lines(SEXP str, SEXP fname, SEXP encoding, SEXP sep)
+{
+    const char* enc = stri__prepare_arg_enc(encoding, "encoding", true); /* this is R_alloc'ed */
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    PROTECT(sep = stri__prepare_arg_string_1(sep, "sep"));
+    PROTECT(fname = stri__prepare_arg_string_1(fname, "con"));
+    if (STRING_ELT(fname, 0) == NA_STRING || STRING_ELT(sep, 0) == NA_STRING) {
+        UNPROTECT(3);
+        Rf_error(MSG__ARG_EXPECTED_NOT_NA,
+            (STRING_ELT(sep, 0) == NA_STRING)?"sep":"con"); // allowed here
+    }
+    const char* fname_s = stri__prepare_fname(STRING_ELT(fname, 0));
+
+    // the output used to be stri_join(str, sep, collapse=""), i.e., NA,
+    // and writeBin failed before opening the file; do not touch it either
+    R_len_t str_n = LENGTH(str);
+    for (R_len_t i=0; i<str_n; ++i) {
+        if (STRING_ELT(str, i) == NA_STRING) {
+            UNPROTECT(3);
+            Rf_error(MSG__FILE_WRITE_NA); // allowed here
+        }
+    }
+
+    STRI__ERROR_HANDLER_BEGIN(3)
+    StriContainerUTF8 str_cont(str, str_n);
+    StriContainerUTF8 sep_cont(sep, 1);
+
+    StriLineWriter w(fname_s, enc);
+    const char* sep_s = sep_cont.get(0).c_str();
+    size_t sep_n = (size_t)sep_cont.get(0).length();
+    for (R_len_t i=0; i<str_n; ++i) {
+        w.write(str_cont.get(i).c_str(), (size_t)str_cont.get(i).length());
+        w.write(sep_s, sep_n);
+    }
+    w.close();
+
+    STRI__UNPROTECT_ALL
+    return R_NilValue;
+    STRI__ERROR_HANDLER_END({/* no special action on error */})
+}
@@ -0,0 +1,128 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __stri_icu_cache_h
+#define __stri_icu_cache_h
+
+#include "stri_stringi.h"
+#include <unicode/translit.h>
+#include <unicode/brkiter.h>
+#include <map>
+#include <string>
+
+
+/**
+ * A process-wide cache of ICU objects (prototypes) that are expensive
+ * to create (they load locale data, compile patterns, etc.),
+ * but cheap to clone
+ *
+ * The prototypes are never handed out: get() returns a fresh clone
+ * that the caller owns and may modify freely.
+ *
+ * Only accessed from the main thread; the objects are freed
+ * explicitly with clear() (e.g., before u_cleanup()).
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+template <class T>
+class StriICUCache {
+
+private:
+
+    typedef std::map<std::string, T*> Map;
+
+    Map m_protos;
+    size_t m_maxSize;
+    double m_hits;
+    double m_misses;
+
+    StriICUCache(const StriICUCache&); /* no copy-able */
+    StriICUCache& operator=(const StriICUCache&);
+
+public:
+
+    StriICUCache(size_t maxSize)
+        : m_maxSize(maxSize), m_hits(0.0), m_misses(0.0) { }
+
+    /** get a clone of the object with a given key
+     *
+     * @param key
+     * @return a new object or NULL if not found (a miss)
+     */
+    T* get(const std::string& key) {
+        typename Map::iterator it = m_protos.find(key);
+        if (it == m_protos.end()) {
+            m_misses += 1;
+            return NULL;
+        }
+        m_hits += 1;
+        return static_cast<T*>(it->second->clone());
+    }
+
+    /** store a clone of an object
+     *
+     * @param key
+     * @param obj object to copy (still owned by the caller)
+     */
+    void put(const std::string& key, const T* obj) {
+        if (m_protos.count(key) > 0)
+            return;
+        if (m_protos.size() >= m_maxSize) {
+            // make room; the keys are usually few and used repeatedly
+            delete m_protos.begin()->second;
+            m_protos.erase(m_protos.begin());
+        }
+        m_protos[key] = static_cast<T*>(obj->clone());
+    }
+
+    void getStats(double* hits, double* misses, double* idle) const {
+        *hits = m_hits;
+        *misses = m_misses;
+        *idle = (double)m_protos.size();
+    }
+
+    void clear() {
+        for (typename Map::iterator it = m_protos.begin(); it != m_protos.end(); ++it)
+            delete it->second;
+        m_protos.clear();
+        m_hits = 0.0;
+        m_misses = 0.0;
+    }
+};
+
+
+/* the caches are defined in the .cpp files that use them;
+   see also stri_time_cache.h */
+StriICUCache<Transliterator>& stri__transliterator_cache();
+StriICUCache<BreakIterator>& stri__brkiter_cache();
+
+#endif
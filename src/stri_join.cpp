@@ -134,12 +134,15 @@ SEXP stri__prepare_arg_list_ignore_null(SEXP x, bool ignore_null)
  *
  * @version 1.7.6.9001 (Marek Gagolewski, 2022-03-15)
  *    #473: use size_t
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
 */
 SEXP stri_dup(SEXP str, SEXP times)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
     PROTECT(times = stri__prepare_arg_integer(times, "times")); // prepare string argument
-    R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(times));
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(times));
     if (vectorize_length <= 0) {
         UNPROTECT(2);
         return Rf_allocVector(STRSXP, 0);
@@ -152,7 +155,7 @@ SEXP stri_dup(SEXP str, SEXP times)
     // STEP 1.
     // Calculate the required buffer length
     size_t bufsize = 0;
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
         if (str_cont.isNA(i) || times_cont.isNA(i) || times_cont.get(i) < 0)
             continue;
 
@@ -175,7 +178,7 @@ SEXP stri_dup(SEXP str, SEXP times)
     const String8* str_last = NULL; // this will allow for reusing buffer...
     size_t str_last_index  = 0;    // ...useful for stri_dup('a', 1:1000) or stri_dup('a', 1000:1)
 
-    for (R_len_t i = str_cont.vectorize_init(); // this iterator allows for...
+    for (R_xlen_t i = str_cont.vectorize_init(); // this iterator allows for...
             i != str_cont.vectorize_end();        // ...smart buffer reusage
             i = str_cont.vectorize_next(i))
     {
@@ -248,15 +251,17 @@ SEXP stri_dup(SEXP str, SEXP times)
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    #112: str_prepare_arg* retvals were not PROTECTed from gc
  *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
 */
 SEXP stri_join2(SEXP e1, SEXP e2) // a.k.a. stri_join2_nocollapse
 {
     PROTECT(e1 = stri__prepare_arg_string(e1, "e1")); // prepare string argument
     PROTECT(e2 = stri__prepare_arg_string(e2, "e2")); // prepare string argument
 
-    R_len_t e1_length = LENGTH(e1);
-    R_len_t e2_length = LENGTH(e2);
-    R_len_t vectorize_length = stri__recycling_rule(true, 2, e1_length, e2_length);
+    R_xlen_t e1_length = XLENGTH(e1);
+    R_xlen_t e2_length = XLENGTH(e2);
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, e1_length, e2_length);
 
     if (e1_length <= 0) {
         UNPROTECT(2);
@@ -273,7 +278,7 @@ SEXP stri_join2(SEXP e1, SEXP e2) // a.k.a. stri_join2_nocollapse
 
     // 1. find maximal length of the buffer needed
     size_t nchar = 0;
-    for (int i=0; i<vectorize_length; ++i) {
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
         if (e1_cont.isNA(i) || e2_cont.isNA(i))
             continue;
 
@@ -294,7 +299,7 @@ SEXP stri_join2(SEXP e1, SEXP e2) // a.k.a. stri_join2_nocollapse
     // 3. Set retval
     const String8* last_string_1 = NULL;
     R_len_t last_buf_idx = 0;
-    for (R_len_t i = e1_cont.vectorize_init(); // this iterator allows for...
+    for (R_xlen_t i = e1_cont.vectorize_init(); // this iterator allows for...
             i != e1_cont.vectorize_end();        // ...smart buffer reusage
             i = e1_cont.vectorize_next(i))
     {
@@ -345,6 +350,9 @@ SEXP stri_join2(SEXP e1, SEXP e2) // a.k.a. stri_join2_nocollapse
  *
  *  @version 0.4-1 (Marek Gagolewski, 2014-11-26)
  *    #114: inconsistent behaviour w.r.t. paste()
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
 */
 SEXP stri_join2_withcollapse(SEXP e1, SEXP e2, SEXP collapse)
 {
@@ -361,9 +369,9 @@ SEXP stri_join2_withcollapse(SEXP e1, SEXP e2, SEXP collapse)
         return stri__vector_NA_strings(1);
     }
 
-    R_len_t e1_length = LENGTH(e1);
-    R_len_t e2_length = LENGTH(e2);
-    R_len_t vectorize_length = stri__recycling_rule(true, 2, e1_length, e2_length);
+    R_xlen_t e1_length = XLENGTH(e1);
+    R_xlen_t e2_length = XLENGTH(e2);
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, e1_length, e2_length);
 
     if (e1_length <= 0 || e2_length <= 0) {
         UNPROTECT(3);
@@ -380,7 +388,7 @@ SEXP stri_join2_withcollapse(SEXP e1, SEXP e2, SEXP collapse)
 
     // find maximal length of the buffer needed:
     size_t nchar = 0;
-    for (int i=0; i<vectorize_length; ++i) {
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
         if (e1_cont.isNA(i) || e2_cont.isNA(i)) {
             STRI__UNPROTECT_ALL
             return stri__vector_NA_strings(1); // at least 1 NA => return NA
@@ -395,7 +403,7 @@ SEXP stri_join2_withcollapse(SEXP e1, SEXP e2, SEXP collapse)
         throw StriException(MSG__CHARSXP_2147483647);
     String8buf buf(nchar);
     R_len_t last_buf_idx = 0;
-    for (R_len_t i = 0; i < vectorize_length; ++i) // don't change this order, see #114
+    for (R_xlen_t i = 0; i < vectorize_length; ++i) // don't change this order, see #114
     {
         // no need to detect NAs - they already have been excluded
         if (collapse_nbytes > 0 && i > 0) { // copy collapse (separator)
@@ -452,6 +460,9 @@ SEXP stri_join2_withcollapse(SEXP e1, SEXP e2, SEXP collapse)
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-11-27)
  *    FR #116: ignore_null arg added
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_join_nocollapse(SEXP strlist, SEXP sep, SEXP ignore_null)
 {
@@ -466,9 +477,9 @@ SEXP stri_join_nocollapse(SEXP strlist, SEXP sep, SEXP ignore_null)
     }
 
     // get length of the longest character vector on the list, i.e., vectorize_length
-    R_len_t vectorize_length = 0;
+    R_xlen_t vectorize_length = 0;
     for (R_len_t i=0; i<strlist_length; ++i) {
-        R_len_t strlist_cur_length = LENGTH(VECTOR_ELT(strlist, i));
+        R_xlen_t strlist_cur_length = XLENGTH(VECTOR_ELT(strlist, i));
         if (strlist_cur_length <= 0) {
             UNPROTECT(1);
             return stri__vector_empty_strings(0);
@@ -512,7 +523,7 @@ SEXP stri_join_nocollapse(SEXP strlist, SEXP sep, SEXP ignore_null)
     // 4. Get buf size and determine where NAs will occur
     size_t buf_maxbytes = 0;
     vector<bool> whichNA(vectorize_length, false); // where are NAs in out?
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
 
         size_t curchar = 0;
         for (R_len_t j=0; j<strlist_length; ++j) {
@@ -535,7 +546,7 @@ SEXP stri_join_nocollapse(SEXP strlist, SEXP sep, SEXP ignore_null)
     String8buf buf(buf_maxbytes);
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
 
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
         if (whichNA[i]) {
             SET_STRING_ELT(ret, i, NA_STRING);
             continue;
@@ -590,6 +601,9 @@ SEXP stri_join_nocollapse(SEXP strlist, SEXP sep, SEXP ignore_null)
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-11-27)
  *    FR #116: ignore_null arg added
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_join(SEXP strlist, SEXP sep, SEXP collapse, SEXP ignore_null)
 {
@@ -633,9 +647,9 @@ SEXP stri_join(SEXP strlist, SEXP sep, SEXP collapse, SEXP ignore_null)
     }
 
     // get length of the longest character vector on the list, i.e., vectorize_length
-    R_len_t vectorize_length = 0;
+    R_xlen_t vectorize_length = 0;
     for (R_len_t i=0; i<strlist_length; ++i) {
-        R_len_t strlist_cur_length = LENGTH(VECTOR_ELT(strlist, i));
+        R_xlen_t strlist_cur_length = XLENGTH(VECTOR_ELT(strlist, i));
         if (strlist_cur_length <= 0) {
             UNPROTECT(3);
             return stri__vector_empty_strings(1);
@@ -659,7 +673,7 @@ SEXP stri_join(SEXP strlist, SEXP sep, SEXP collapse, SEXP ignore_null)
 
     // Get required buffer size
     size_t buf_maxbytes = 0;
-    for (R_len_t i=0; i<vectorize_length; ++i) {   // for each vectorized string (vertically)
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {   // for each vectorized string (vertically)
         for (R_len_t j=0; j<strlist_length; ++j) {  // for each character vector  (horizontally)
             if (strlist_cont.get(j).isNA(i)) {
                 STRI__UNPROTECT_ALL
@@ -678,7 +692,7 @@ SEXP stri_join(SEXP strlist, SEXP sep, SEXP collapse, SEXP ignore_null)
     String8buf buf(buf_maxbytes);
     size_t last_buf_idx = 0;
 
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
         // there is no NA anywhere
 
         if (collapse_n > 0 && i > 0) {
@@ -744,11 +758,14 @@ SEXP stri_join(SEXP strlist, SEXP sep, SEXP collapse, SEXP ignore_null)
  *
  * @version 1.6.2 (Marek Gagolewski, 2021-05-10)
  *    #428 na_empty=NA support
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_flatten_noressep(SEXP str, int na_empty)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str"));
-    R_len_t str_length = LENGTH(str);
+    R_xlen_t str_length = XLENGTH(str);
     if (str_length <= 0) {
         UNPROTECT(1);
         return stri__vector_empty_strings(1);
@@ -759,7 +776,7 @@ SEXP stri_flatten_noressep(SEXP str, int na_empty)
 
     // 1. Get required buffer size
     size_t nchar = 0;
-    for (int i=0; i<str_length; ++i) {
+    for (R_xlen_t i=0; i<str_length; ++i) {
         if (str_cont.isNA(i)) {
             if (na_empty == NA_LOGICAL || na_empty) {
                 nchar += 0; // ignore
@@ -779,7 +796,7 @@ SEXP stri_flatten_noressep(SEXP str, int na_empty)
         throw StriException(MSG__CHARSXP_2147483647);
     String8buf buf(nchar);
     size_t cur = 0;
-    for (int i=0; i<str_length; ++i) {
+    for (R_xlen_t i=0; i<str_length; ++i) {
         if (!str_cont.isNA(i)) {
             size_t ncur = str_cont.get(i).length();
             memcpy(buf.data()+cur, str_cont.get(i).c_str(), (size_t)ncur);
@@ -829,6 +846,8 @@ SEXP stri_flatten_noressep(SEXP str, int na_empty)
  * @version 1.6.2 (Marek Gagolewski, 2021-05-10)
  *    #428 na_empty=NA support
  *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_flatten(SEXP str, SEXP collapse, SEXP na_empty, SEXP omit_empty) // a.k.a. C_stri_flatten_withressep
 {
@@ -849,7 +868,7 @@ SEXP stri_flatten(SEXP str, SEXP collapse, SEXP na_empty, SEXP omit_empty) // a.
     }
 
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
-    R_len_t str_length = LENGTH(str);
+    R_xlen_t str_length = XLENGTH(str);
     if (str_length <= 0) {
         UNPROTECT(2);
         return stri__vector_empty_strings(1);
@@ -864,7 +883,7 @@ SEXP stri_flatten(SEXP str, SEXP collapse, SEXP na_empty, SEXP omit_empty) // a.
 
     // 1. Get required minimal buffer size
     size_t nbytes = 0;
-    for (int i=0; i<str_length; ++i) {
+    for (R_xlen_t i=0; i<str_length; ++i) {
         if (str_cont.isNA(i)) {
             if (na_empty_1 == NA_LOGICAL) {
                 nbytes += 0;  // do nothing
@@ -888,7 +907,7 @@ SEXP stri_flatten(SEXP str, SEXP collapse, SEXP na_empty, SEXP omit_empty) // a.
     String8buf buf(nbytes);
     size_t cur = 0;
     bool already_started = false;
-    for (int i=0; i<str_length; ++i) {
+    for (R_xlen_t i=0; i<str_length; ++i) {
         if (na_empty_1 == NA_LOGICAL && str_cont.isNA(i))
             continue;
 
@@ -32,6 +32,12 @@
 #include "stri_stringi.h"
 #include "stri_ucnv.h"
 #include "stri_container_utf8.h"
+#include "stri_parallel.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
 
 
 /**
@@ -91,6 +97,9 @@ R_len_t stri__numbytes_max(SEXP str)
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-05-22)
  *    use stri__length_string for UTF-8
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support; count UTF-8 strings in multiple threads
  */
 SEXP stri_length(SEXP str)
 {
@@ -98,14 +107,19 @@ SEXP stri_length(SEXP str)
 
     STRI__ERROR_HANDLER_BEGIN(1)
 
-    R_len_t str_n = LENGTH(str);
+    R_xlen_t str_n = XLENGTH(str);
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_n));
     int* retint = INTEGER(ret);
 
     StriUcnv ucnvNative(NULL);
 
-    for (R_len_t k = 0; k < str_n; k++) {
+    // UTF-8 strings are counted later, possibly in multiple threads;
+    // CHARSXPs are only accessed here, in the main thread
+    int nworkers = StriParallel::getNumWorkers(str_n);
+    std::vector< std::pair<R_xlen_t, const char*> > deferred;
+
+    for (R_xlen_t k = 0; k < str_n; k++) {
         SEXP curs = STRING_ELT(str, k);
         if (curs == NA_STRING) {
             retint[k] = NA_INTEGER;
@@ -121,7 +135,12 @@ SEXP stri_length(SEXP str)
         }
         else if (IS_UTF8(curs) || ucnvNative.isUTF8()) { // UTF-8 or native is UTF-8
             const char* curs_s = CHAR(curs);  // TODO: ALTREP will be problematic?
-            retint[k] = stri__length_string(curs_s, curs_n);
+            if (nworkers > 1) {
+                retint[k] = curs_n;
+                deferred.push_back(std::make_pair(k, curs_s));
+            }
+            else
+                retint[k] = stri__length_string(curs_s, curs_n);
         }
         else if (ucnvNative.is8bit()) { // native-8bit
             retint[k] = curs_n;
@@ -144,6 +163,16 @@ SEXP stri_length(SEXP str)
         }
     }
 
+    if (!deferred.empty()) {
+        StriParallel::run((R_xlen_t)deferred.size(), nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int /*worker*/) {
+                for (R_xlen_t d = from; d < to; ++d) {
+                    R_xlen_t k = deferred[d].first;
+                    retint[k] = stri__length_string(deferred[d].second, retint[k]);
+                }
+            });
+    }
+
     STRI__UNPROTECT_ALL
     return ret;
 
@@ -166,17 +195,20 @@ SEXP stri_length(SEXP str)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_numbytes(SEXP str)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
-    R_len_t str_n = LENGTH(str);
+    R_xlen_t str_n = XLENGTH(str);
 
     STRI__ERROR_HANDLER_BEGIN(1)
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_n));
     int* retint = INTEGER(ret);
-    for (R_len_t i=0; i<str_n; ++i) {
+    for (R_xlen_t i=0; i<str_n; ++i) {
         SEXP curs = STRING_ELT(str, i);
         /* INPUT ENCODING CHECK: this function does not need this. */
         retint[i] = (curs == NA_STRING)?NA_INTEGER:LENGTH(curs); // O(1) - stored by R
@@ -202,17 +234,20 @@ SEXP stri_numbytes(SEXP str)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_isempty(SEXP str)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
-    R_len_t str_n = LENGTH(str);
+    R_xlen_t str_n = XLENGTH(str);
 
     STRI__ERROR_HANDLER_BEGIN(1)
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, str_n));
     int* retlog = LOGICAL(ret);
-    for (R_len_t i=0; i<str_n; ++i) {
+    for (R_xlen_t i=0; i<str_n; ++i) {
         SEXP curs = STRING_ELT(str, i);
         /* INPUT ENCODING CHECK: this function does not need this. */
         retlog[i] = (curs == NA_STRING)?NA_LOGICAL:(LENGTH(curs) <= 0);
@@ -245,10 +280,13 @@ SEXP stri_isempty(SEXP str)
  * @version 1.6.2 (Marek Gagolewski, 2021-05-13)
  *    bugfixes
  *
+ * @version 1.8.8 (2026-10-19)
+ *    used only to build the lookup table, see stri__width_char
+ *
  * @param c code point
  * @return 0, 1, or 2
  */
-int stri__width_char(UChar32 c)
+static int stri__width_char_icu(UChar32 c)
 {
     /* Characters with the \code{UCHAR_EAST_ASIAN_WIDTH} enumerable property
        equal to \code{U_EA_FULLWIDTH} or \code{U_EA_WIDE} are of width 2. */
@@ -341,6 +379,136 @@ int stri__width_char(UChar32 c)
 
 
 
+/** Can a code point continue an emoji ZWJ sequence?
+ *
+ * Used only to build the lookup table, see stri__width_char_with_context.
+ *
+ * @param c code point
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__width_zwj_cont_icu(UChar32 c)
+{
+#if U_ICU_VERSION_MAJOR_NUM>=57
+    // UCHAR_EMOJI_* is ICU >= 57
+    return (
+        u_hasBinaryProperty(c, UCHAR_EMOJI_MODIFIER) ||
+        u_hasBinaryProperty(c, UCHAR_EMOJI_PRESENTATION) ||
+        c == 0x2640 /* FEMALE */ ||
+        c == 0x2642 /* MALE */ ||
+        c == 0x26A7 /* TRANSGENDER */ ||
+        c == 0x2695 /* HEALTH */ ||
+        c == 0x2696 /* JUDGE */ ||
+        c == 0x1F5E8 /* SPEECH */ ||
+        c == 0x1F32B /* CLOUDS */ ||
+        c == 0x2708 /* PLANE */ ||
+        c == 0x2764 /* HEART */ ||
+        c == 0x2744 /* SNOWFLAKE */ ||
+        c == 0x2620 /* SKULL AND CROSSBONES */
+    );
+#else // U_ICU_VERSION_MAJOR_NUM < 57 - no emoji support
+    return false;
+#endif
+}
+
+
+/* Two-level lookup table for the character widths.
+ *
+ * Each code point has an 8-bit entry: the width (0, 1, or 2) in the two
+ * lowest bits and STRI__WIDTH_ZWJ_CONT if it can continue an emoji
+ * ZWJ sequence. Stage 1 maps each block of 256 code points to a block
+ * in stage 2, where identical blocks are shared (most of the code
+ * space is unassigned or consists of runs of CJK ideographs).
+ *
+ * The blocks are built from ICU properties on first use (building
+ * the whole table takes ~0.1s, too long to do it when the package
+ * is loaded). As stri_width etc. may be called from many threads
+ * (StriParallel, the C API), the blocks are built under a mutex
+ * and published via atomic pointers; once set, they never change.
+ */
+#define STRI__WIDTH_BLOCK_SHIFT 8
+#define STRI__WIDTH_BLOCK_SIZE  (1<<STRI__WIDTH_BLOCK_SHIFT)
+#define STRI__WIDTH_NBLOCKS     (0x110000>>STRI__WIDTH_BLOCK_SHIFT)
+#define STRI__WIDTH_MASK        0x03
+#define STRI__WIDTH_ZWJ_CONT    0x04
+
+static std::atomic<const uint8_t*> stri__width_stage1[STRI__WIDTH_NBLOCKS];  // NULL = not built yet
+static std::mutex stri__width_mutex;
+
+
+/** Build a block of the width lookup table
+ *
+ * @param block block index, < STRI__WIDTH_NBLOCKS
+ * @return the block's entries
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static const uint8_t* stri__width_build_block(R_len_t block)
+{
+    // stage 2: identical blocks are stored once; std::set's elements never move
+    static std::set<std::string> known_blocks;
+
+    std::string entries(STRI__WIDTH_BLOCK_SIZE, '\0');
+    UChar32 c0 = (UChar32)block<<STRI__WIDTH_BLOCK_SHIFT;
+    for (R_len_t k=0; k<STRI__WIDTH_BLOCK_SIZE; ++k) {
+        UChar32 c = c0+k;
+        uint8_t e = (uint8_t)stri__width_char_icu(c);
+        if (stri__width_zwj_cont_icu(c)) e |= STRI__WIDTH_ZWJ_CONT;
+        entries[k] = (char)e;
+    }
+
+    std::lock_guard<std::mutex> lock(stri__width_mutex);
+    const uint8_t* ret = stri__width_stage1[block].load(std::memory_order_relaxed);
+    if (ret) return ret;  // another thread was quicker
+
+    ret = (const uint8_t*)known_blocks.insert(entries).first->data();
+    stri__width_stage1[block].store(ret, std::memory_order_release);
+    return ret;
+}
+
+
+/** Get the width lookup table entry for a code point
+ *
+ * @param c code point, 0 <= c <= 0x10FFFF
+ * @return width | (STRI__WIDTH_ZWJ_CONT if applicable)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static inline uint8_t stri__width_entry(UChar32 c)
+{
+    R_len_t block = (R_len_t)(c>>STRI__WIDTH_BLOCK_SHIFT);
+    const uint8_t* entries = stri__width_stage1[block].load(std::memory_order_acquire);
+    if (!entries)
+        entries = stri__width_build_block(block);
+
+    return entries[c&(STRI__WIDTH_BLOCK_SIZE-1)];
+}
+
+
+/** Get width of a single character
+ *
+ * See stri__width_char_icu for the rules; this function
+ * uses the lookup table built from the ICU properties.
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    lookup table, ASCII fast path
+ *
+ * @param c code point
+ * @return 0, 1, or 2
+ */
+int stri__width_char(UChar32 c)
+{
+    if (c >= 0 && c < 0x80)  // ASCII: Cc are of width 0
+        return (c >= 0x20 && c != 0x7F);
+
+    if (c < 0 || c > 0x10FFFF)
+        return stri__width_char_icu(c);
+
+    return (int)(stri__width_entry(c)&STRI__WIDTH_MASK);
+}
+
+
 /** Get width of a single character (context-dependent)
  *
  * inspired by http://www.cl.cam.ac.uk/~mgk25/ucs/wcwidth.c
@@ -350,6 +518,9 @@ int stri__width_char(UChar32 c)
  * @version 1.6.3 (Marek Gagolewski, 2021-06-14)
  *    stand-alone fun
  *
+ * @version 1.8.8 (2026-10-19)
+ *    lookup table, see stri__width_zwj_cont_icu
+ *
  * @param c code point
  * @param p previous code point
  * @return int
@@ -361,28 +532,21 @@ int stri__width_char_with_context(UChar32 c, UChar32 p, bool& reset)
         reset = false;
     }
 
-#if U_ICU_VERSION_MAJOR_NUM>=57
-    // UCHAR_EMOJI_* is ICU >= 57
+    if (c >= 0 && c < 0x80)  // ASCII: no contextual rules apply
+        return (c >= 0x20 && c != 0x7F);
+
+    if (c < 0 || c > 0x10FFFF)
+        return stri__width_char_icu(c);
+
+    uint8_t e = stri__width_entry(c);
+
     if (
-        /*j > 0 &&*/ p == 0x200D /* ZERO WIDTH JOINER */ && (
-            u_hasBinaryProperty(c, UCHAR_EMOJI_MODIFIER) ||
-            u_hasBinaryProperty(c, UCHAR_EMOJI_PRESENTATION) ||
-            c == 0x2640 /* FEMALE */ ||
-            c == 0x2642 /* MALE */ ||
-            c == 0x26A7 /* TRANSGENDER */ ||
-            c == 0x2695 /* HEALTH */ ||
-            c == 0x2696 /* JUDGE */ ||
-            c == 0x1F5E8 /* SPEECH */ ||
-            c == 0x1F32B /* CLOUDS */ ||
-            c == 0x2708 /* PLANE */ ||
-            c == 0x2764 /* HEART */ ||
-            c == 0x2744 /* SNOWFLAKE */ ||
-            c == 0x2620 /* SKULL AND CROSSBONES */
-        )
+        /*j > 0 &&*/ p == 0x200D /* ZERO WIDTH JOINER */ && (e&STRI__WIDTH_ZWJ_CONT)
     ) {
         // emoji sequence - ignore (display might not support it)
         return 0;
     }
+#if U_ICU_VERSION_MAJOR_NUM>=57
     else if (
         /*j > 0 &&*/ (p >= 0x1F1E6 && p <= 0x1F1FF)
         && (c >= 0x1F1E6 && c <= 0x1F1FF)
@@ -391,12 +555,10 @@ int stri__width_char_with_context(UChar32 c, UChar32 p, bool& reset)
         reset = true;  // allow the next flag to be recognised
         return 0;
     }
+#endif
     else {
-        return stri__width_char(c);
+        return (int)(e&STRI__WIDTH_MASK);
     }
-#else // U_ICU_VERSION_MAJOR_NUM < 57 - no emoji support
-    return stri__width_char(c);
-#endif
 }
 
 
@@ -410,16 +572,36 @@ int stri__width_char_with_context(UChar32 c, UChar32 p, bool& reset)
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-05-22)
  *    extracted from stri_length
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    skip ASCII runs block-wise (stri__utf8_ascii_prefix);
+ *    validate and count block-wise if max_length is NA
  */
 int stri__length_string(const char* str_cur_s, int str_cur_n, int max_length)
 {
     // is string is in ASCII, then length == str_cur_n, but with
     // merely str_cur_s ptr we are unable to tell that here
 
+    if (max_length == NA_INTEGER) {
+        if (stri__utf8_invalid_offset(str_cur_s, str_cur_n) >= 0)
+            throw StriException(MSG__INVALID_UTF8);
+        return stri__utf8_count_codepoints(str_cur_s, str_cur_n);
+    }
+
     UChar32 c = 0;
     R_len_t j = 0;
     R_len_t cur_length = 0;
     while (j < str_cur_n) {
+        // each ASCII byte is a valid code point
+        R_len_t nascii = stri__utf8_ascii_prefix(str_cur_s+j, str_cur_n-j);
+        if (nascii > 0) {
+            if (max_length != NA_INTEGER && cur_length+nascii > max_length)
+                return j+(max_length-cur_length);
+            j += nascii;
+            cur_length += nascii;
+            if (j >= str_cur_n) break;
+        }
+
         R_len_t prevj = j;
         U8_NEXT(str_cur_s, j, str_cur_n, c); // faster that U8_FWD_1 & gives bad UChar32s
         if (c < 0)
@@ -453,6 +635,9 @@ int stri__length_string(const char* str_cur_s, int str_cur_n, int max_length)
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-05-22)
  *    max_width
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII fast path
  */
 int stri__width_string(const char* str_cur_s, int str_cur_n, int max_width)
 {
@@ -465,11 +650,21 @@ int stri__width_string(const char* str_cur_s, int str_cur_n, int max_width)
     while (j < str_cur_n) {
         R_len_t prevj = j;
         p = c;
-        U8_NEXT(str_cur_s, j, str_cur_n, c);
-        if (c < 0)
-            throw StriException(MSG__INVALID_UTF8);
+        c = (uint8_t)str_cur_s[j];
+        if (c < 0x80) {
+            // ASCII: no contextual rules apply (and an ASCII p
+            // does not start any), see stri__width_char_with_context
+            ++j;
+            reset = false;
+            cur_width += (c >= 0x20 && c != 0x7F);
+        }
+        else {
+            U8_NEXT(str_cur_s, j, str_cur_n, c);
+            if (c < 0)
+                throw StriException(MSG__INVALID_UTF8);
 
-        cur_width += stri__width_char_with_context(c, p, reset);
+            cur_width += stri__width_char_with_context(c, p, reset);
+        }
 
         // test if max_width exceeded (here; there may be zero-width chars)
         if (max_width != NA_INTEGER && cur_width > max_width)
@@ -483,6 +678,41 @@ int stri__width_string(const char* str_cur_s, int str_cur_n, int max_width)
 }
 
 
+/** Get the width of a single ASCII string or get the position where
+ *  a substring of <= max_width ends
+ *
+ * Gives the same results as \code{stri__width_string}: control
+ * characters (Cc) are of width 0, all the other ASCII characters
+ * are of width 1, and none of the contextual rules apply.
+ *
+ * @param str_cur_s string, in ASCII
+ * @param str_cur_n number of bytes in str_cur_s
+ * @param max_width
+ * @return width of the whole string (if max_width==NA_INTEGER)
+ * or index
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stri__width_string_ascii(const char* str_cur_s, int str_cur_n, int max_width)
+{
+    int cur_width = 0;
+    for (R_len_t j = 0; j < str_cur_n; ++j) {
+        unsigned char c = (unsigned char)str_cur_s[j];
+        STRI_ASSERT(c <= ASCII_MAXCHARCODE);
+        if (c >= 0x20 && c < ASCII_MAXCHARCODE) {
+            cur_width++;
+            if (max_width != NA_INTEGER && cur_width > max_width)
+                return j;
+        }
+    }
+
+    if (max_width == NA_INTEGER)
+        return cur_width;
+    else
+        return str_cur_n;  // the whole string has width <= max_width
+}
+
+
 /**
   * Determine the width of strings
   *
@@ -490,20 +720,37 @@ int stri__width_string(const char* str_cur_s, int str_cur_n, int max_width)
   * @return integer vector
   *
   * @version 0.5-1 (Marek Gagolewski, 2015-04-22)
+  *
+  * @version 1.8.8 (2026-10-19)
+  *    long vector support; ASCII fast path; multithreading
   */
 SEXP stri_width(SEXP str)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
 
     STRI__ERROR_HANDLER_BEGIN(1)
-    R_len_t str_n = LENGTH(str);
+    R_xlen_t str_n = XLENGTH(str);
     StriContainerUTF8 str_cont(str, str_n);
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_n));
     int* retint = INTEGER(ret);
 
-    for (R_len_t i = str_cont.vectorize_init();
+    int nworkers = StriParallel::getNumWorkers(str_n);
+    if (nworkers > 1) {
+        StriParallel::run(str_n, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int /*worker*/) {
+                for (R_xlen_t i = from; i < to; ++i) {
+                    retint[i] = (str_cont.isNA(i))?NA_INTEGER:
+                        str_cont.get(i).countWidth();
+                }
+            });
+
+        STRI__UNPROTECT_ALL
+        return ret;
+    }
+
+    for (R_xlen_t i = str_cont.vectorize_init();
             i != str_cont.vectorize_end();
             i = str_cont.vectorize_next(i))
     {
@@ -512,9 +759,7 @@ SEXP stri_width(SEXP str)
             continue;
         }
 
-        const char* str_cur_s = str_cont.get(i).c_str();
-        R_len_t     str_cur_n = str_cont.get(i).length();
-        retint[i] = stri__width_string(str_cur_s, str_cur_n);
+        retint[i] = str_cont.get(i).countWidth();
     }
 
     STRI__UNPROTECT_ALL
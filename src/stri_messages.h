@@ -85,6 +85,12 @@
 #define MSG__INCORRECT_BRKITER_OPTION_SPEC \
    "incorrect break iterator option specifier, see ?stri_opts_brkiter"
 
+#define MSG__INCORRECT_OPTION \
+   "unknown option: '%s', see ?stri_options"
+
+#define MSG__INCORRECT_OPTIONS_SPEC \
+   "incorrect option specifier, see ?stri_options"
+
 #define MSG__INCORRECT_FIXED_OPTION \
    "incorrect opts_fixed setting: '%s'; ignoring"
 
@@ -149,6 +155,9 @@
 #define MSG__EXPECTED_POSITIVE \
    "expected a positive numeric value"
 
+#define MSG__EXPECTED_PROBABILITY \
+   "expected a numeric value in [0, 1]"
+
 #define MSG__EXPECTED_SMALLER \
    "value too large"
 
@@ -294,6 +303,9 @@
 #define MSG__ARG_EXPECTED_RAW_IN_LIST_NO_COERCION \
    "all elements in `%s` should be a raw vectors"
 
+#define MSG__ARG_EXPECTED_PACKED \
+   "argument `%s` should be a well-formed `stri_packed` object"
+
 #define MSG__ARG_EXPECTED_RAW_NO_COERCION \
    "argument `%s` should be a raw vector"
 
@@ -360,6 +372,21 @@
 #define MSG__U_CHARSET_IS_UTF8 \
    "system ICU assumes that the default character set is always UTF-8, and hence this function has no effect"
 
+#define MSG__FILE_OPEN_ERROR \
+   "cannot open file '%s'"
+
+#define MSG__FILE_READ_ERROR \
+   "error reading from file '%s'"
+
+#define MSG__FILE_WRITE_ERROR \
+   "error writing to file '%s'"
+
+#define MSG__FILE_WRITE_NA \
+   "missing values cannot be written; the file has not been modified"
+
+#define MSG__EMBEDDED_NUL \
+   "embedded NUL characters are not supported"
+
 #define MSG__CHARSXP_2147483647 \
     "Elements of character vectors (CHARSXPs) are limited to 2^31-1 bytes"
 
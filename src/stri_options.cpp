@@ -0,0 +1,184 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_ucnv.h"
+#include "stri_time_cache.h"
+
+
+/* Package-wide settings, see stri_options() in R.
+ * These are only ever modified from the main thread via stri_options_set.
+ */
+static bool stri__options_lazy_substrings = false;
+static int  stri__options_threads = 1;
+
+
+/** Should substring-extracting functions return lazy (ALTREP) vectors?
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool stri__getopt_lazy_substrings()
+{
+    return stri__options_lazy_substrings;
+}
+
+
+/** Maximal number of threads to use, see StriParallel
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int stri__getopt_threads()
+{
+    return stri__options_threads;
+}
+
+
+/** Get the current package-wide settings
+ *
+ * @return named list
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_options_get()
+{
+    const R_len_t nopts = 2;
+    SEXP ret;
+    PROTECT(ret = Rf_allocVector(VECSXP, nopts));
+    SET_VECTOR_ELT(ret, 0, Rf_ScalarLogical(stri__options_lazy_substrings));
+    SET_VECTOR_ELT(ret, 1, Rf_ScalarInteger(stri__options_threads));
+    stri__set_names(ret, nopts, "lazy_substrings", "threads");
+    UNPROTECT(1);
+    return ret;
+}
+
+
+/** Modify the package-wide settings
+ *
+ * Settings are validated before any of them is applied.
+ *
+ * @param opts named list
+ * @return named list with the previous settings
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_options_set(SEXP opts)
+{
+    if (!Rf_isVectorList(opts))
+        Rf_error(MSG__INCORRECT_OPTIONS_SPEC); // error() allowed here
+
+    R_len_t narg = LENGTH(opts);
+    SEXP names = PROTECT(Rf_getAttrib(opts, R_NamesSymbol));
+    if (narg > 0 && (names == R_NilValue || LENGTH(names) != narg))
+        Rf_error(MSG__INCORRECT_OPTIONS_SPEC); // error() allowed here
+
+    bool opt_lazy_substrings = stri__options_lazy_substrings;
+    int  opt_threads = stri__options_threads;
+
+    for (R_len_t i=0; i<narg; ++i) {
+        if (STRING_ELT(names, i) == NA_STRING)
+            Rf_error(MSG__INCORRECT_OPTIONS_SPEC); // error() allowed here
+
+        SEXP tmp_arg;
+        PROTECT(tmp_arg = STRING_ELT(names, i));
+        const char* curname = stri__copy_string_Ralloc(tmp_arg, "curname");  /* this is R_alloc'ed */
+        UNPROTECT(1);
+
+        PROTECT(tmp_arg = VECTOR_ELT(opts, i));
+        if (!strcmp(curname, "lazy_substrings")) {
+            opt_lazy_substrings = stri__prepare_arg_logical_1_notNA(tmp_arg, "lazy_substrings");
+        } else if (!strcmp(curname, "threads")) {
+            opt_threads = stri__prepare_arg_integer_1_notNA(tmp_arg, "threads");
+            if (opt_threads <= 0)
+                Rf_error(MSG__INCORRECT_NAMED_ARG "; " MSG__EXPECTED_POSITIVE, "threads"); // error() allowed here
+        } else {
+            Rf_error(MSG__INCORRECT_OPTION, curname); // error() allowed here
+        }
+        UNPROTECT(1);
+    }
+    UNPROTECT(1); /* names */
+
+    SEXP ret;
+    PROTECT(ret = stri_options_get());
+
+    stri__options_lazy_substrings = opt_lazy_substrings;
+    stri__options_threads = opt_threads;
+
+    UNPROTECT(1);
+    return ret;
+}
+
+
+/** Get (and optionally reset) the statistics of the internal caches
+ *
+ * @param reset single logical; whether to free the cached objects
+ *    and zero the counters (after the statistics are gathered)
+ * @return named list of named numeric vectors
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_cache_info(SEXP reset)
+{
+    bool reset_val = stri__prepare_arg_logical_1_notNA(reset, "reset");
+
+    const R_len_t ncaches = 6;
+    SEXP ret, tmp;
+    PROTECT(ret = Rf_allocVector(VECSXP, ncaches));
+
+    for (R_len_t i=0; i<ncaches; ++i) {
+        PROTECT(tmp = Rf_allocVector(REALSXP, 3));
+        switch (i) {
+            case 0: StriUcnv::getPoolStats(REAL(tmp), REAL(tmp)+1, REAL(tmp)+2); break;
+            case 1: stri__timezone_cache().getStats(REAL(tmp), REAL(tmp)+1, REAL(tmp)+2); break;
+            case 2: stri__calendar_cache().getStats(REAL(tmp), REAL(tmp)+1, REAL(tmp)+2); break;
+            case 3: stri__date_format_cache().getStats(REAL(tmp), REAL(tmp)+1, REAL(tmp)+2); break;
+            case 4: stri__transliterator_cache().getStats(REAL(tmp), REAL(tmp)+1, REAL(tmp)+2); break;
+            case 5: stri__brkiter_cache().getStats(REAL(tmp), REAL(tmp)+1, REAL(tmp)+2); break;
+        }
+        stri__set_names(tmp, 3, "hits", "misses", "idle");
+        SET_VECTOR_ELT(ret, i, tmp);
+        UNPROTECT(1);
+    }
+
+    stri__set_names(ret, ncaches, "ucnv", "timezone", "calendar", "datetime_format",
+        "transliterator", "brkiter");
+
+    if (reset_val) {
+        StriUcnv::clearPool();
+        stri__time_cache_clear();
+        stri__transliterator_cache().clear();
+        stri__brkiter_cache().clear();
+    }
+
+    UNPROTECT(1);
+    return ret;
+}
@@ -0,0 +1,129 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_packed.h"
+
+
+/** Create the R object
+ *
+ * @return list of class \code{stri_packed} (unprotected)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP StriPackedRaw::toR()
+{
+    R_xlen_t n = (R_xlen_t)na.size();
+    SEXP ret, tmp;
+    PROTECT(ret = Rf_allocVector(VECSXP, 3));
+
+    PROTECT(tmp = Rf_allocVector(RAWSXP, (R_xlen_t)data.size()));
+    if (!data.empty()) memcpy(RAW(tmp), data.data(), data.size());
+    SET_VECTOR_ELT(ret, 0, tmp);
+    UNPROTECT(1);
+
+    if (data.size() <= (size_t)INT_MAX) {
+        PROTECT(tmp = Rf_allocVector(INTSXP, n+1));
+        int* tmp_tab = INTEGER(tmp);
+        for (R_xlen_t i=0; i<=n; ++i)
+            tmp_tab[i] = (int)offsets[i];
+    }
+    else {
+        PROTECT(tmp = Rf_allocVector(REALSXP, n+1));
+        memcpy(REAL(tmp), offsets.data(), sizeof(double)*(n+1));
+    }
+    SET_VECTOR_ELT(ret, 1, tmp);
+    UNPROTECT(1);
+
+    PROTECT(tmp = Rf_allocVector(LGLSXP, n));
+    if (n > 0) memcpy(LOGICAL(tmp), na.data(), sizeof(int)*n);
+    SET_VECTOR_ELT(ret, 2, tmp);
+    UNPROTECT(1);
+
+    stri__set_names(ret, 3, "data", "offsets", "na");
+    Rf_setAttrib(ret, R_ClassSymbol, Rf_mkString("stri_packed"));
+
+    UNPROTECT(1);
+    return ret;
+}
+
+
+/** Is an object a packed raw vector?
+ *
+ * @param x R object
+ * @return true if x is a list of class \code{stri_packed}
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriPackedRaw::isPacked(SEXP x)
+{
+    return Rf_isVectorList(x) && Rf_inherits(x, "stri_packed");
+}
+
+
+/** Check if a packed raw vector is well-formed
+ *
+ * WARNING: this function is allowed to call the error() function.
+ * Use before STRI__ERROR_HANDLER_BEGIN (with other prepareargs).
+ *
+ * @param x a list of class \code{stri_packed}
+ * @param argname argument name (message formatting)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriPackedRaw::check(SEXP x, const char* argname)
+{
+    if (!isPacked(x) || XLENGTH(x) != 3)
+        Rf_error(MSG__ARG_EXPECTED_PACKED, argname);  // error() allowed here
+
+    SEXP data = VECTOR_ELT(x, 0);
+    SEXP offsets = VECTOR_ELT(x, 1);
+    SEXP na = VECTOR_ELT(x, 2);
+    if (TYPEOF(data) != RAWSXP || TYPEOF(na) != LGLSXP ||
+            (TYPEOF(offsets) != INTSXP && TYPEOF(offsets) != REALSXP) ||
+            XLENGTH(offsets) != XLENGTH(na)+1)
+        Rf_error(MSG__ARG_EXPECTED_PACKED, argname);  // error() allowed here
+
+    R_xlen_t n = XLENGTH(na);
+    double ndata = (double)XLENGTH(data);
+    double last = 0.0;
+    for (R_xlen_t i=0; i<=n; ++i) {
+        double cur = (TYPEOF(offsets) == INTSXP)
+            ? (INTEGER(offsets)[i] == NA_INTEGER ? -1.0 : (double)INTEGER(offsets)[i])
+            : REAL(offsets)[i];
+        // !(cur >= last) is also true for NaNs
+        if (!(cur >= last) || cur > ndata || cur != (double)(R_xlen_t)cur ||
+                (i > 0 && cur-last > (double)INT_MAX))
+            Rf_error(MSG__ARG_EXPECTED_PACKED, argname);  // error() allowed here
+        last = cur;
+    }
+}
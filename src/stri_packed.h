@@ -0,0 +1,95 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __stri_packed_h
+#define __stri_packed_h
+
+#include "stri_stringi.h"
+#include <vector>
+
+
+/**
+ * Builds a packed raw vector: a list of class \code{stri_packed} with
+ * a single raw vector (\code{data}) holding all the byte strings one
+ * after another, their start offsets (\code{offsets}, of length n+1,
+ * Arrow-style; integer or, for data beyond 2^31-1 bytes, double),
+ * and missing value indicators (\code{na}, logical of length n).
+ *
+ * This avoids creating one R object per string, see \code{stri_encode}
+ * and \code{stri_sort_key}. Packed vectors can be used wherever
+ * lists of raw vectors are accepted, see \code{StriContainerListRaw}.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriPackedRaw {
+
+private:
+
+    std::vector<char> data;
+    std::vector<double> offsets;
+    std::vector<int> na;
+
+
+public:
+
+    StriPackedRaw(R_xlen_t n=0)
+    {
+        offsets.reserve((size_t)n+1);
+        na.reserve((size_t)n);
+        offsets.push_back(0.0);
+    }
+
+
+    /** Append a byte string */
+    void add(const char* s, size_t n)
+    {
+        data.insert(data.end(), s, s+n);
+        offsets.push_back((double)data.size());
+        na.push_back(FALSE);
+    }
+
+
+    /** Append a missing value */
+    void addNA()
+    {
+        offsets.push_back((double)data.size());
+        na.push_back(TRUE);
+    }
+
+
+    SEXP toR();
+
+    static bool isPacked(SEXP x);
+    static void check(SEXP x, const char* argname);
+};
+
+#endif
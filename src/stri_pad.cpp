@@ -62,6 +62,9 @@
  * @version 0.5-1 (Marek Gagolewski, 2015-04-22)
  *    `use_length` arg added,
  *    second argument renamed `width`
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII fast paths
 */
 SEXP stri_pad(SEXP str, SEXP width, SEXP side, SEXP pad, SEXP use_length)
 {
@@ -117,15 +120,21 @@ SEXP stri_pad(SEXP str, SEXP width, SEXP side, SEXP pad, SEXP use_length)
         if (use_length_val) {
             pad_cur_width = 1;
             str_cur_width = str_cont.get(i).countCodePoints();
-            R_len_t k = 0;
-            UChar32 pad_cur = 0;
-            U8_NEXT(pad_cur_s, k, pad_cur_n, pad_cur);
-            if (pad_cur <= 0 || k < pad_cur_n)
-                throw StriException(MSG__NOT_EQ_N_CODEPOINTS, "pad", 1);
+            if (pad_cont.get(i).isASCII()) {
+                if (pad_cur_n != 1)
+                    throw StriException(MSG__NOT_EQ_N_CODEPOINTS, "pad", 1);
+            }
+            else {
+                R_len_t k = 0;
+                UChar32 pad_cur = 0;
+                U8_NEXT(pad_cur_s, k, pad_cur_n, pad_cur);
+                if (pad_cur <= 0 || k < pad_cur_n)
+                    throw StriException(MSG__NOT_EQ_N_CODEPOINTS, "pad", 1);
+            }
         }
         else {
-            pad_cur_width = stri__width_string(pad_cur_s, pad_cur_n);
-            str_cur_width = stri__width_string(str_cur_s, str_cur_n);
+            pad_cur_width = pad_cont.get(i).countWidth();
+            str_cur_width = str_cont.get(i).countWidth();
             if (pad_cur_width != 1)
                 throw StriException(MSG__NOT_EQ_N_WIDTH, "pad", 1);
         }
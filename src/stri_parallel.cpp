@@ -0,0 +1,293 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_parallel.h"
+#include <new>
+
+#ifndef STRI_DISABLE_THREADS
+#define STRI__PARALLEL_THREADS 1
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#else
+#define STRI__PARALLEL_THREADS 0
+#endif
+
+
+#if STRI__PARALLEL_THREADS
+/**
+ * A pool of worker threads, created on first use
+ *
+ * Each job is a function called once by every participating worker
+ * (the main thread being worker 0); the main thread waits until
+ * all of them are done.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriThreadPool {
+
+private:
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable cv_job;
+    std::condition_variable cv_done;
+
+    const std::function<void(int)>* job;
+    int job_nworkers;     ///< workers participating in the current job
+    int job_pending;      ///< workers that have not finished it yet
+    unsigned long job_id; ///< incremented for each job
+    bool stopping;
+
+
+    void loop(int worker)
+    {
+        unsigned long last_job_id = 0;
+        while (true) {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv_job.wait(lock, [&]{ return stopping || job_id != last_job_id; });
+            if (stopping) return;
+            last_job_id = job_id;
+            if (worker >= job_nworkers) continue;  // not needed this time
+            const std::function<void(int)>* f = job;
+            lock.unlock();
+
+            (*f)(worker);  // exceptions are caught by f
+
+            lock.lock();
+            if (--job_pending == 0)
+                cv_done.notify_one();
+        }
+    }
+
+
+public:
+
+    StriThreadPool()
+    {
+        job = NULL;
+        job_nworkers = 0;
+        job_pending = 0;
+        job_id = 0;
+        stopping = false;
+    }
+
+
+    ~StriThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv_job.notify_all();
+        for (size_t i=0; i<threads.size(); ++i)
+            threads[i].join();
+    }
+
+
+    /** Run f(0), f(1), ..., f(nworkers-1) concurrently
+     *
+     * If the system refuses to start new threads (e.g., EAGAIN),
+     * only the workers that are already available take part;
+     * in the worst case, f(0) is run on the calling thread alone.
+     */
+    void execute(int nworkers, const std::function<void(int)>& f)
+    {
+        try {
+            // no reallocation below: a joinable std::thread must never be
+            // destroyed, which could happen if push_back threw
+            threads.reserve(nworkers-1);
+            while ((int)threads.size() < nworkers-1) {
+                int worker = (int)threads.size()+1;
+                threads.push_back(std::thread(&StriThreadPool::loop, this, worker));
+            }
+        }
+        catch (...) {  // std::system_error, std::bad_alloc
+            ;
+        }
+
+        if (nworkers > (int)threads.size()+1)
+            nworkers = (int)threads.size()+1;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &f;
+            job_nworkers = nworkers;
+            job_pending = nworkers-1;
+            ++job_id;
+        }
+        cv_job.notify_all();
+
+        f(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cv_done.wait(lock, [&]{ return job_pending == 0; });
+        job = NULL;
+    }
+};
+
+
+static StriThreadPool* stri__parallel_pool = NULL;
+#ifndef _WIN32
+static pid_t stri__parallel_pool_pid = 0;
+#endif
+#endif
+
+
+/** Get the number of workers to process n items
+ *
+ * @param n number of items
+ * @param min_chunk the smallest number of items per worker
+ * @return a number between 1 and \code{stri_options()$threads}
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int StriParallel::getNumWorkers(R_xlen_t n, R_xlen_t min_chunk)
+{
+#if STRI__PARALLEL_THREADS
+    int nthreads = stri__getopt_threads();
+    if (nthreads <= 1 || n < 2*min_chunk)
+        return 1;
+    R_xlen_t nmax = n/min_chunk;
+    return (nmax < (R_xlen_t)nthreads)?(int)nmax:nthreads;
+#else
+    return 1;
+#endif
+}
+
+
+/** Process \code{[0, n)} in chunks, using \code{nworkers} threads
+ *
+ * @param n number of items
+ * @param nworkers see getNumWorkers()
+ * @param task called for each chunk: task(from, to, worker)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriParallel::run(R_xlen_t n, int nworkers, const Task& task)
+{
+    if (n <= 0) return;
+
+#if STRI__PARALLEL_THREADS
+    if (nworkers > 1) {
+#ifndef _WIN32
+        if (stri__parallel_pool && stri__parallel_pool_pid != getpid()) {
+            // a forked child process (e.g., parallel::mclapply) does not
+            // inherit the threads; leak the parent's pool
+            stri__parallel_pool = NULL;
+        }
+#endif
+        if (!stri__parallel_pool) {
+            stri__parallel_pool = new (std::nothrow) StriThreadPool();
+#ifndef _WIN32
+            stri__parallel_pool_pid = getpid();
+#endif
+        }
+    }
+
+    if (nworkers > 1 && stri__parallel_pool) {
+
+        // several chunks per worker to balance the load
+        R_xlen_t chunk = n/((R_xlen_t)nworkers*4);
+        if (chunk < 1) chunk = 1;
+
+        std::atomic<R_xlen_t> next(0);
+        std::atomic<bool> failed(false);
+        std::mutex err_mutex;
+        std::vector<StriException> err;  // at most one
+
+        std::function<void(int)> f = [&](int worker) {
+            try {
+                while (!failed.load()) {
+                    R_xlen_t from = next.fetch_add(chunk);
+                    if (from >= n) break;
+                    R_xlen_t to = (from+chunk < n)?(from+chunk):n;
+                    task(from, to, worker);
+                }
+            }
+            catch (StriException& e) {
+                std::lock_guard<std::mutex> lock(err_mutex);
+                if (err.empty()) err.push_back(e);
+                failed = true;
+            }
+            catch (std::bad_alloc&) {
+                std::lock_guard<std::mutex> lock(err_mutex);
+                if (err.empty()) err.push_back(StriException(MSG__MEM_ALLOC_ERROR));
+                failed = true;
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(err_mutex);
+                if (err.empty()) err.push_back(StriException(MSG__INTERNAL_ERROR));
+                failed = true;
+            }
+        };
+
+        stri__parallel_pool->execute(nworkers, f);
+
+        if (!err.empty())
+            throw err[0];
+        return;
+    }
+#endif
+
+    task(0, n, 0);
+}
+
+
+/** Stop all the worker threads
+ *
+ * Called when the package is unloaded.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriParallel::shutdown()
+{
+#if STRI__PARALLEL_THREADS
+#ifndef _WIN32
+    if (stri__parallel_pool && stri__parallel_pool_pid != getpid()) {
+        stri__parallel_pool = NULL;  // see run()
+        return;
+    }
+#endif
+    if (stri__parallel_pool) {
+        delete stri__parallel_pool;
+        stri__parallel_pool = NULL;
+    }
+#endif
+}
@@ -0,0 +1,88 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef __stri_parallel_h
+#define __stri_parallel_h
+
+#include "stri_stringi.h"
+#include <functional>
+
+
+/* Threads are used unless STRI_DISABLE_THREADS is defined,
+ * see stri_parallel.cpp */
+
+
+/// the smallest number of items worth passing to a worker thread
+#define STRI__PARALLEL_MIN_CHUNK 1024
+
+
+/**
+ * Splits work on vectorised operations across a pool of threads,
+ * see \code{stri_options(threads=...)}
+ *
+ * The R API must only be used from the main thread, so the data
+ * should be prepared beforehand (e.g., in a StriContainerUTF8)
+ * and the results be stored in plain arrays (e.g., \code{INTEGER(ret)})
+ * or staged in C++ objects and committed to R afterwards.
+ *
+ * Example:
+ * \code{
+ *    int nworkers = StriParallel::getNumWorkers(n);
+ *    std::vector<String8buf> bufs(nworkers);  // per-worker scratch buffers
+ *    StriParallel::run(n, nworkers, [&](R_xlen_t from, R_xlen_t to, int worker) {
+ *        for (R_xlen_t i=from; i<to; ++i)
+ *            ret_tab[i] = ...;  // may throw StriException
+ *    });
+ * }
+ *
+ * The callable is invoked for consecutive, disjoint chunks of \code{[0, n)};
+ * \code{worker} is in \code{[0, nworkers)}, with 0 being the main thread,
+ * and no two chunks with the same \code{worker} are processed concurrently.
+ * The first StriException thrown by any worker is rethrown by \code{run}
+ * on the main thread (once all the workers have finished), so that it
+ * can be handled by STRI__ERROR_HANDLER_END as usual.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriParallel {
+
+public:
+
+    typedef std::function<void(R_xlen_t, R_xlen_t, int)> Task;
+
+    static int getNumWorkers(R_xlen_t n, R_xlen_t min_chunk=STRI__PARALLEL_MIN_CHUNK);
+    static void run(R_xlen_t n, int nworkers, const Task& task);
+    static void shutdown();
+};
+
+#endif
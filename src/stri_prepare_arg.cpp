@@ -31,6 +31,8 @@
 
 
 #include "stri_stringi.h"
+#include "stri_packed.h"
+#include "stri_time_cache.h"
 #include <unicode/uloc.h>
 
 
@@ -117,8 +119,8 @@ SEXP stri__handler_null(SEXP /*cond*/, void* /*data*/)
 bool stri__check_list_of_scalars(SEXP x)
 {
     STRI_ASSERT(Rf_isVectorList(x));
-    R_len_t nv = LENGTH(x);
-    for (R_len_t i=0; i<nv; ++i) {
+    R_xlen_t nv = XLENGTH(x);
+    for (R_xlen_t i=0; i<nv; ++i) {
         SEXP cur = VECTOR_ELT(x, i);
         if (!(Rf_isVectorAtomic(cur) && LENGTH(cur) == 1)) {
             return false;
@@ -170,6 +172,9 @@ SEXP stri__prepare_arg_list(SEXP x, const char* argname)
  * check only is performed
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-08-08)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    accept packed raw vectors (see StriPackedRaw)
  */
 SEXP stri__prepare_arg_list_raw(SEXP x, const char* argname)
 {
@@ -179,9 +184,13 @@ SEXP stri__prepare_arg_list_raw(SEXP x, const char* argname)
     if (Rf_isNull(x) || isRaw(x)) {
         return x; // single character string (byte data)
     }
+    else if (StriPackedRaw::isPacked(x)) {
+        StriPackedRaw::check(x, argname);
+        return x;
+    }
     else if (Rf_isVectorList(x)) {
-        R_len_t nv = LENGTH(x);
-        for (R_len_t i=0; i<nv; ++i) {
+        R_xlen_t nv = XLENGTH(x);
+        for (R_xlen_t i=0; i<nv; ++i) {
             SEXP cur = VECTOR_ELT(x, i);
             if ((bool)Rf_isNull(cur))
                 continue; // NA
@@ -841,7 +850,7 @@ SEXP stri__prepare_arg_string_1(SEXP x, const char* argname)
 //     }
 
 
-    R_len_t nx = LENGTH(x);
+    R_xlen_t nx = XLENGTH(x);
 
     if (nx <= 0) {
         UNPROTECT(nprotect);
@@ -938,7 +947,7 @@ SEXP stri__prepare_arg_double_1(SEXP x, const char* argname, bool factors_as_str
 //         return x; // avoid compiler warning
 //     }
 
-    R_len_t nx = LENGTH(x);
+    R_xlen_t nx = XLENGTH(x);
 
     if (nx <= 0) {
         UNPROTECT(nprotect);
@@ -1035,7 +1044,7 @@ SEXP stri__prepare_arg_integer_1(SEXP x, const char* argname, bool factors_as_st
 //         return x; // avoid compiler warning
 //     }
 
-    R_len_t nx = LENGTH(x);
+    R_xlen_t nx = XLENGTH(x);
 
     if (nx <= 0) {
         UNPROTECT(nprotect);
@@ -1140,7 +1149,7 @@ SEXP stri__prepare_arg_logical_1(SEXP x, const char* argname)
 //         return x; // avoid compiler warning
 //     }
 
-    R_len_t nx = LENGTH(x);
+    R_xlen_t nx = XLENGTH(x);
 
     if (nx <= 0) {
         UNPROTECT(nprotect);
@@ -1574,10 +1583,14 @@ const char* stri__prepare_arg_locale(
  *
  *
  * @version 0.5-1 (Marek Gagolewski, 2014-12-24)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    reuse time zones from the cache
  */
 TimeZone* stri__prepare_arg_timezone(SEXP tz, const char* argname, bool allowdefault)
 {
     UnicodeString tz_val("");
+    std::string tz_key;  // time zone cache key
 
     if (!Rf_isNull(tz)) {
         PROTECT(tz = stri__prepare_arg_string_1(tz, argname));
@@ -1585,7 +1598,8 @@ TimeZone* stri__prepare_arg_timezone(SEXP tz, const char* argname, bool allowdef
             UNPROTECT(1);
             Rf_error(MSG__ARG_EXPECTED_NOT_NA, argname); // Rf_error allowed here
         }
-        tz_val.setTo(UnicodeString((const char*)CHAR(STRING_ELT(tz, 0))));
+        tz_key = (const char*)CHAR(STRING_ELT(tz, 0));
+        tz_val.setTo(UnicodeString(tz_key.c_str()));
         UNPROTECT(1);
     }
 
@@ -1604,13 +1618,18 @@ TimeZone* stri__prepare_arg_timezone(SEXP tz, const char* argname, bool allowdef
         return TimeZone::createDefault();
     }
     else {
-        TimeZone* ret = TimeZone::createTimeZone(tz_val);
+        TimeZone* ret = stri__timezone_cache().get(tz_key);
+        if (ret) return ret;
+
+        ret = TimeZone::createTimeZone(tz_val);
         if (*ret == TimeZone::getUnknown()) {
             delete ret;
             Rf_error(MSG__TIMEZONE_INCORRECT_ID); // allowed here
         }
-        else
+        else {
+            stri__timezone_cache().put(tz_key, ret);
             return ret;
+        }
     }
 
     // won't arrive here anyway
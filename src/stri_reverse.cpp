@@ -54,6 +54,9 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII fast path
  */
 SEXP stri_reverse(SEXP str)
 {
@@ -93,6 +96,15 @@ SEXP stri_reverse(SEXP str)
         R_len_t str_cur_n = str_cont.get(i).length();
         const char* str_cur_s = str_cont.get(i).c_str();
 
+        if (str_cont.get(i).isASCII()) {
+            // one byte == one code point
+            char* bufdata = buf.data();
+            for (R_len_t j=0; j<str_cur_n; ++j)
+                bufdata[j] = str_cur_s[str_cur_n-1-j];
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(bufdata, str_cur_n, CE_UTF8));
+            continue;
+        }
+
         R_len_t j, k;
         UChar32 chr;
         UBool isError = FALSE;
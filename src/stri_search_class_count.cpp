@@ -58,13 +58,16 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support; ASCII fast path
  */
 SEXP stri_count_charclass(SEXP str, SEXP pattern)
 {
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
-    R_len_t vectorize_length =
-        stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length =
+        stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
 
     STRI__ERROR_HANDLER_BEGIN(2)
     StriContainerUTF8 str_cont(str, vectorize_length);
@@ -74,7 +77,7 @@ SEXP stri_count_charclass(SEXP str, SEXP pattern)
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_tab = INTEGER(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
@@ -89,7 +92,12 @@ SEXP stri_count_charclass(SEXP str, SEXP pattern)
 
         UChar32 chr   = 0;
         R_len_t count = 0;
-        for (R_len_t j=0; j<str_cur_n; ) {
+        if (str_cont.get(i).isASCII()) {
+            const bool* ascii_cur = pattern_cont.getASCIITable(i);
+            for (R_len_t j=0; j<str_cur_n; ++j)
+                count += (R_len_t)ascii_cur[(unsigned char)str_cur_s[j]];
+        }
+        else for (R_len_t j=0; j<str_cur_n; ) {
             U8_NEXT(str_cur_s, j, str_cur_n, chr);
             if (chr < 0) // invalid utf-8 sequence
                 throw StriException(MSG__INVALID_UTF8);
@@ -69,6 +69,9 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-08)
  *    #232: `max_count` arg added
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support; ASCII fast path
  */
 SEXP stri_detect_charclass(SEXP str, SEXP pattern,
                            SEXP negate, SEXP max_count)
@@ -77,8 +80,8 @@ SEXP stri_detect_charclass(SEXP str, SEXP pattern,
     int max_count_1 = stri__prepare_arg_integer_1_notNA(max_count, "max_count");
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
-    R_len_t vectorize_length =
-        stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length =
+        stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
 
     STRI__ERROR_HANDLER_BEGIN(2)
     StriContainerUTF8 str_cont(str, vectorize_length);
@@ -88,7 +91,7 @@ SEXP stri_detect_charclass(SEXP str, SEXP pattern,
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
@@ -103,7 +106,16 @@ SEXP stri_detect_charclass(SEXP str, SEXP pattern,
 
         UChar32 chr = 0;
         ret_tab[i] = FALSE;
-        for (R_len_t j=0; j<str_cur_n; ) {
+        if (str_cont.get(i).isASCII()) {
+            const bool* ascii_cur = pattern_cont.getASCIITable(i);
+            for (R_len_t j=0; j<str_cur_n; ++j) {
+                if (ascii_cur[(unsigned char)str_cur_s[j]]) {
+                    ret_tab[i] = TRUE;
+                    break;
+                }
+            }
+        }
+        else for (R_len_t j=0; j<str_cur_n; ) {
             U8_NEXT(str_cur_s, j, str_cur_n, chr);
             if (chr < 0) // invalid UTF-8 sequence
                 throw StriException(MSG__INVALID_UTF8);
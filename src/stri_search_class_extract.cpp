@@ -192,6 +192,9 @@ SEXP stri_extract_last_charclass(SEXP str, SEXP pattern)
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-04)
  *    allow `simplify=NA`
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          ASCII fast path
  */
 SEXP stri_extract_all_charclass(SEXP str, SEXP pattern, SEXP merge, SEXP simplify, SEXP omit_no_match)
 {
@@ -225,7 +228,8 @@ SEXP stri_extract_all_charclass(SEXP str, SEXP pattern, SEXP merge, SEXP simplif
         StriContainerCharClass::locateAll(
             occurrences, &pattern_cont.get(i),
             str_cur_s, str_cur_n, merge_cur,
-            false /* byte-based indexes */
+            false /* byte-based indexes */,
+            str_cont.get(i).isASCII()?pattern_cont.getASCIITable(i):NULL
         );
 
         R_len_t noccurrences = (R_len_t)occurrences.size();
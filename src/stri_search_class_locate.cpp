@@ -199,6 +199,9 @@ SEXP stri_locate_last_charclass(SEXP str, SEXP pattern, SEXP get_length)
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-29)
  *     get_length
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          ASCII fast path
  */
 SEXP stri_locate_all_charclass(SEXP str, SEXP pattern, SEXP merge, SEXP omit_no_match, SEXP get_length)
 {
@@ -230,7 +233,8 @@ SEXP stri_locate_all_charclass(SEXP str, SEXP pattern, SEXP merge, SEXP omit_no_
         StriContainerCharClass::locateAll(
             occurrences, &pattern_cont.get(i),
             str_cont.get(i).c_str(), str_cont.get(i).length(), merge_cur,
-            true /* code point-based indexes */
+            true /* code point-based indexes */,
+            str_cont.get(i).isASCII()?pattern_cont.getASCIITable(i):NULL
         );
 
         R_len_t noccurrences = (R_len_t)occurrences.size();
@@ -74,6 +74,9 @@ using namespace std;
  *
  * @version 1.0-2 (Marek Gagolewski, 2016-01-30)
  *    Issue #210: Allow NA replacement
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          ASCII fast path
  */
 SEXP stri__replace_all_charclass_yes_vectorize_all(SEXP str, SEXP pattern, SEXP replacement, SEXP merge)
 {
@@ -109,7 +112,8 @@ SEXP stri__replace_all_charclass_yes_vectorize_all(SEXP str, SEXP pattern, SEXP
         R_len_t sumbytes = StriContainerCharClass::locateAll(
                                occurrences, &pattern_cont.get(i),
                                str_cur_s, str_cur_n, merge_cur,
-                               false /* byte-based indices */
+                               false /* byte-based indices */,
+                               str_cont.get(i).isASCII()?pattern_cont.getASCIITable(i):NULL
                            );
 
         if (occurrences.size() == 0) {
@@ -161,6 +165,9 @@ SEXP stri__replace_all_charclass_yes_vectorize_all(SEXP str, SEXP pattern, SEXP
  *
  * @version 1.0-2 (Marek Gagolewski, 2016-01-30)
  *    Issue #210: Allow NA replacement
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          ASCII fast path
  */
 SEXP stri__replace_all_charclass_no_vectorize_all(SEXP str, SEXP pattern, SEXP replacement, SEXP merge)
 {
@@ -216,7 +223,8 @@ SEXP stri__replace_all_charclass_no_vectorize_all(SEXP str, SEXP pattern, SEXP r
             R_len_t sumbytes = StriContainerCharClass::locateAll(
                                    occurrences, &pattern_cont.get(i),
                                    str_cur_s, str_cur_n, merge_cur,
-                                   false /* byte-based indices */
+                                   false /* byte-based indices */,
+                                   str_cont.get(j).isASCII()?pattern_cont.getASCIITable(i):NULL
                                );
 
             if (occurrences.size() == 0)
@@ -58,6 +58,9 @@
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-17)
  *    assure LENGTH(pattern) <= LENGTH(str)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII fast path
  */
 SEXP stri_subset_charclass(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate)
 {
@@ -106,7 +109,16 @@ SEXP stri_subset_charclass(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate)
 
         UChar32 chr = 0;
         which[i] = FALSE;
-        for (R_len_t j=0; j<str_cur_n; ) {
+        if (str_cont.get(i).isASCII()) {
+            const bool* ascii_cur = pattern_cont.getASCIITable(i);
+            for (R_len_t j=0; j<str_cur_n; ++j) {
+                if (ascii_cur[(unsigned char)str_cur_s[j]]) {
+                    which[i] = TRUE;
+                    break;
+                }
+            }
+        }
+        else for (R_len_t j=0; j<str_cur_n; ) {
             U8_NEXT(str_cur_s, j, str_cur_n, chr);
             if (chr < 0) // invalid UTF-8 sequence
                 throw StriException(MSG__INVALID_UTF8);
@@ -144,6 +156,9 @@ SEXP stri_subset_charclass(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate)
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-17)
  *    assure LENGTH(pattern) and LENGTH(value) <= LENGTH(str)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    ASCII fast path
  */
 SEXP stri_subset_charclass_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP value)
 {
@@ -195,7 +210,16 @@ SEXP stri_subset_charclass_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP
 
         UChar32 chr = 0;
         bool found = false;
-        for (R_len_t j=0; j<str_cur_n; ) {
+        if (str_cont.get(i).isASCII()) {
+            const bool* ascii_cur = pattern_cont.getASCIITable(i);
+            for (R_len_t j=0; j<str_cur_n; ++j) {
+                if (ascii_cur[(unsigned char)str_cur_s[j]]) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        else for (R_len_t j=0; j<str_cur_n; ) {
             U8_NEXT(str_cur_s, j, str_cur_n, chr);
             if (chr < 0) // invalid UTF-8 sequence
                 throw StriException(MSG__INVALID_UTF8);
@@ -58,6 +58,9 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
 {
@@ -70,7 +73,7 @@ SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
     collator = stri__ucol_open(opts_collator);
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
     StriContainerUTF16 str_cont(str, vectorize_length);
     StriContainerUStringSearch pattern_cont(pattern, vectorize_length, collator);  // collator is not owned by pattern_cont
 
@@ -78,7 +81,7 @@ SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_tab = INTEGER(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
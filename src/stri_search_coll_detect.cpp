@@ -66,6 +66,9 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-08)
  *    #232: `max_count` arg added
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate,
                       SEXP max_count, SEXP opts_collator)
@@ -81,7 +84,7 @@ SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate,
     collator = stri__ucol_open(opts_collator);
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
     StriContainerUTF16 str_cont(str, vectorize_length);
     StriContainerUStringSearch pattern_cont(pattern, vectorize_length, collator);  // collator is not owned by pattern_cont
 
@@ -89,7 +92,7 @@ SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate,
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
@@ -34,6 +34,7 @@
 #include "stri_container_base.h"
 #include "stri_container_utf8.h"
 #include "stri_container_bytesearch.h"
+#include "stri_parallel.h"
 
 
 /**
@@ -67,6 +68,9 @@
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  *    use StriByteSearchMatcher
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support; multithreading
  */
 SEXP stri_count_fixed(SEXP str, SEXP pattern, SEXP opts_fixed)
 {
@@ -75,7 +79,7 @@ SEXP stri_count_fixed(SEXP str, SEXP pattern, SEXP opts_fixed)
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
     StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerByteSearch pattern_cont(pattern, vectorize_length, pattern_flags);
 
@@ -83,7 +87,29 @@ SEXP stri_count_fixed(SEXP str, SEXP pattern, SEXP opts_fixed)
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_tab = INTEGER(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    int nworkers = StriParallel::getNumWorkers(vectorize_length);
+    if (nworkers > 1) {
+        std::vector< std::unique_ptr<StriByteSearchMatcher> > matchers(nworkers);
+        StriParallel::run(vectorize_length, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int worker) {
+                for (R_xlen_t i = from; i < to; ++i) {
+                    STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
+                            ret_tab[i] = NA_INTEGER, ret_tab[i] = 0)
+
+                    StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, matchers[worker]);
+                    matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+                    R_len_t found = 0;
+                    while (USEARCH_DONE != matcher->findNext())
+                        ++found;
+                    ret_tab[i] = found;
+                }
+            });
+
+        STRI__UNPROTECT_ALL
+        return ret;
+    }
+
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
@@ -33,6 +33,7 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_bytesearch.h"
+#include "stri_parallel.h"
 
 
 /**
@@ -72,6 +73,9 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-08)
  *    #232: `max_count` arg added
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support; multithreading
  */
 SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
                        SEXP max_count, SEXP opts_fixed)
@@ -83,7 +87,7 @@ SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    int vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length = stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
     StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerByteSearch pattern_cont(pattern, vectorize_length, pattern_flags);
 
@@ -91,7 +95,28 @@ SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    // max_count makes the result depend on the order of processing
+    int nworkers = (max_count_1 < 0)?StriParallel::getNumWorkers(vectorize_length):1;
+    if (nworkers > 1) {
+        std::vector< std::unique_ptr<StriByteSearchMatcher> > matchers(nworkers);
+        StriParallel::run(vectorize_length, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int worker) {
+                for (R_xlen_t i = from; i < to; ++i) {
+                    STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
+                            ret_tab[i] = NA_LOGICAL, ret_tab[i] = negate_1)
+
+                    StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, matchers[worker]);
+                    matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+                    ret_tab[i] = (int)(matcher->findFirst() != USEARCH_DONE);
+                    if (negate_1) ret_tab[i] = !ret_tab[i];
+                }
+            });
+
+        STRI__UNPROTECT_ALL
+        return ret;
+    }
+
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
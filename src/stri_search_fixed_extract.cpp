@@ -33,6 +33,7 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_bytesearch.h"
+#include "stri_altrep.h"
 #include <deque>
 #include <utility>
 using namespace std;
@@ -56,6 +57,9 @@ using namespace std;
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  *    use StriByteSearchMatcher
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    use StriSubstrings (lazy results if requested)
  */
 SEXP stri__extract_firstlast_fixed(SEXP str, SEXP pattern, SEXP opts_fixed, bool first)
 {
@@ -68,15 +72,16 @@ SEXP stri__extract_firstlast_fixed(SEXP str, SEXP pattern, SEXP opts_fixed, bool
     StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerByteSearch pattern_cont(pattern, vectorize_length, pattern_flags);
 
-    SEXP ret;
-    STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
+    StriSubstrings ret_sub(vectorize_length,
+        StriSubstrings::useLazy(vectorize_length, str_cont.isReadOnly()));
+    STRI__PROTECT(ret_sub.getData());
 
     for (R_len_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
         STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
-                SET_STRING_ELT(ret, i, NA_STRING);, SET_STRING_ELT(ret, i, NA_STRING);)
+                ret_sub.setNA(i);, ret_sub.setNA(i);)
 
         StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
         matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
@@ -87,15 +92,18 @@ SEXP stri__extract_firstlast_fixed(SEXP str, SEXP pattern, SEXP opts_fixed, bool
             start = matcher->findLast();
         }
         if (start == USEARCH_DONE) {
-            SET_STRING_ELT(ret, i, NA_STRING);
+            ret_sub.setNA(i);
             continue;
         }
 
         len = matcher->getMatchedLength();
 
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(str_cont.get(i).c_str()+start, len, CE_UTF8));
+        ret_sub.set(i, str_cont.getSource(i), str_cont.get(i).c_str()+start, len);
     }
 
+    SEXP ret;
+    STRI__PROTECT(ret = ret_sub.toR());
+
     STRI__UNPROTECT_ALL
     return ret;
     STRI__ERROR_HANDLER_END({ /* no-op */ })
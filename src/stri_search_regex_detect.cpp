@@ -69,6 +69,9 @@
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    Use StriContainerRegexPattern::getRegexOptions
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_detect_regex(SEXP str, SEXP pattern, SEXP negate,
                        SEXP max_count, SEXP opts_regex)
@@ -77,8 +80,8 @@ SEXP stri_detect_regex(SEXP str, SEXP pattern, SEXP negate,
     int max_count_1 = stri__prepare_arg_integer_1_notNA(max_count, "max_count");
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
-    R_len_t vectorize_length =
-        stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
+    R_xlen_t vectorize_length =
+        stri__recycling_rule_xlen(true, 2, XLENGTH(str), XLENGTH(pattern));
 
     StriRegexMatcherOptions pattern_opts =
         StriContainerRegexPattern::getRegexOptions(opts_regex);
@@ -92,7 +95,7 @@ SEXP stri_detect_regex(SEXP str, SEXP pattern, SEXP negate,
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
+    for (R_xlen_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
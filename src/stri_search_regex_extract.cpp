@@ -33,6 +33,7 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_regex.h"
+#include "stri_altrep.h"
 #include <deque>
 #include <utility>
 using namespace std;
@@ -57,6 +58,9 @@ using namespace std;
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    Use StriContainerRegexPattern::getRegexOptions
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    use StriSubstrings (lazy results if requested)
  */
 SEXP stri__extract_firstlast_regex(SEXP str, SEXP pattern, SEXP opts_regex, bool first)
 {
@@ -72,15 +76,16 @@ SEXP stri__extract_firstlast_regex(SEXP str, SEXP pattern, SEXP opts_regex, bool
     StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
 
-    SEXP ret;
-    STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
+    StriSubstrings ret_sub(vectorize_length,
+        StriSubstrings::useLazy(vectorize_length, str_cont.isReadOnly()));
+    STRI__PROTECT(ret_sub.getData());
 
     for (R_len_t i = pattern_cont.vectorize_init();
             i != pattern_cont.vectorize_end();
             i = pattern_cont.vectorize_next(i))
     {
         STRI__CONTINUE_ON_EMPTY_OR_NA_PATTERN(str_cont, pattern_cont,
-                                              SET_STRING_ELT(ret, i, NA_STRING);)
+                                              ret_sub.setNA(i);)
 
         UErrorCode status = U_ZERO_ERROR;
         RegexMatcher *matcher = pattern_cont.getMatcher(i); // will be deleted automatically
@@ -100,7 +105,7 @@ SEXP stri__extract_firstlast_regex(SEXP str, SEXP pattern, SEXP opts_regex, bool
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
         else {
-            SET_STRING_ELT(ret, i, NA_STRING);
+            ret_sub.setNA(i);
             continue;
         }
 
@@ -115,9 +120,12 @@ SEXP stri__extract_firstlast_regex(SEXP str, SEXP pattern, SEXP opts_regex, bool
             }
         }
 
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(str_cont.get(i).c_str()+m_start, m_end-m_start, CE_UTF8));
+        ret_sub.set(i, str_cont.getSource(i), str_cont.get(i).c_str()+m_start, m_end-m_start);
     }
 
+    SEXP ret;
+    STRI__PROTECT(ret = ret_sub.toR());
+
     if (str_text) {
         utext_close(str_text);
         str_text = NULL;
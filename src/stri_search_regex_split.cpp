@@ -35,6 +35,7 @@
 #include "stri_container_integer.h"
 #include "stri_container_logical.h"
 #include "stri_container_regex.h"
+#include "stri_altrep.h"
 #include <deque>
 #include <utility>
 using namespace std;
@@ -80,6 +81,9 @@ using namespace std;
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    Use StriContainerRegexPattern::getRegexOptions
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    use StriSubstrings (lazy results if requested)
  */
 SEXP stri_split_regex(SEXP str, SEXP pattern, SEXP n, SEXP omit_empty,
                       SEXP tokens_only, SEXP simplify, SEXP opts_regex)
@@ -178,20 +182,22 @@ SEXP stri_split_regex(SEXP str, SEXP pattern, SEXP n, SEXP omit_empty,
                 fields.pop_back(); // get rid of the remainder
         }
 
-        SEXP ans;
-        STRI__PROTECT(ans = Rf_allocVector(STRSXP, fields.size()));
+        SEXP str_cur_src = str_cont.getSource(i);
+        StriSubstrings ans((R_len_t)fields.size(),
+            StriSubstrings::useLazy((R_len_t)fields.size(), str_cur_src != NULL));
+        STRI__PROTECT(ans.getData());
 
         deque< pair<R_len_t, R_len_t> >::iterator iter = fields.begin();
         for (k = 0; iter != fields.end(); ++iter, ++k) {
             pair<R_len_t, R_len_t> curoccur = *iter;
             if (curoccur.second == curoccur.first && omit_empty_cont.isNA(i))
-                SET_STRING_ELT(ans, k, NA_STRING);
+                ans.setNA(k);
             else
-                SET_STRING_ELT(ans, k,
-                               Rf_mkCharLenCE(str_cur_s+curoccur.first, curoccur.second-curoccur.first, CE_UTF8));
+                ans.set(k, str_cur_src, str_cur_s+curoccur.first,
+                        curoccur.second-curoccur.first);
         }
 
-        SET_VECTOR_ELT(ret, i, ans);
+        SET_VECTOR_ELT(ret, i, ans.toR());
         STRI__UNPROTECT(1);
     }
 
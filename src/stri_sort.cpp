@@ -34,12 +34,14 @@
 #include "stri_container_utf8.h"
 #include "stri_container_utf16.h"
 #include "stri_string8buf.h"
+#include "stri_packed.h"
 #include <unicode/ucol.h>
 #include <unicode/sortkey.h>
 #include <vector>
 #include <deque>
 #include <algorithm>
 #include <set>
+#include <climits>
 
 
 # define STRI_SORTRANKORDER_SORT  1
@@ -59,7 +61,7 @@ struct StriSortComparer {
         this->decreasing = _decreasing;
     }
 
-    bool operator() (int a, int b) const
+    bool operator() (R_xlen_t a, R_xlen_t b) const
     {
 //      if (col) {
         UErrorCode status = U_ZERO_ERROR;
@@ -115,6 +117,10 @@ struct StriSortComparer {
  *
  * @version 1.6.1 (Marek Gagolewski, 2021-04-30)
  *    rank
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support; order and rank return a double vector
+ *    for inputs longer than INT_MAX
  */
 SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
                         SEXP opts_collator, int _type)
@@ -144,16 +150,17 @@ SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
 
     STRI__ERROR_HANDLER_BEGIN(2)
 
-    R_len_t vectorize_length = LENGTH(str);
+    R_xlen_t vectorize_length = XLENGTH(str);
     StriContainerUTF8 str_cont(str, vectorize_length);
 
+    // 1-based indices do not fit into an int for long vectors
+    bool ret_double = (vectorize_length > INT_MAX);
 
+    deque<R_xlen_t> NA_pos;
+    vector<R_xlen_t> order(vectorize_length);
 
-    deque<int> NA_pos;
-    vector<int> order(vectorize_length);
-
-    R_len_t k = 0;
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+    R_xlen_t k = 0;
+    for (R_xlen_t i=0; i<vectorize_length; ++i) {
         if (!str_cont.isNA(i))
             order[k++] = i;
         else if (na_last_int != NA_LOGICAL)
@@ -173,53 +180,63 @@ SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
     if (_type == STRI_SORTRANKORDER_SORT) {
         // sort
         STRI__PROTECT(ret = Rf_allocVector(STRSXP, k+NA_pos.size()));
-        R_len_t j = 0;
+        R_xlen_t j = 0;
         if (na_last_int != NA_LOGICAL && !na_last_int) {
             // put NAs first
-            for (std::deque<int>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j)
+            for (std::deque<R_xlen_t>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j)
                 SET_STRING_ELT(ret, j, NA_STRING);
         }
 
-        for (std::vector<int>::iterator it=order.begin(); it!=order.end(); ++it, ++j)
+        for (std::vector<R_xlen_t>::iterator it=order.begin(); it!=order.end(); ++it, ++j)
             SET_STRING_ELT(ret, j, str_cont.toR(*it));
 
         if (na_last_int != NA_LOGICAL && na_last_int) {
             // put NAs last
-            for (std::deque<int>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j)
+            for (std::deque<R_xlen_t>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j)
                 SET_STRING_ELT(ret, j, NA_STRING);
         }
     }
     else if (_type == STRI_SORTRANKORDER_ORDER) {
-        STRI__PROTECT(ret = Rf_allocVector(INTSXP, k+NA_pos.size()));
-        int* ret_tab = INTEGER(ret);
+        STRI__PROTECT(ret = Rf_allocVector(ret_double?REALSXP:INTSXP, k+NA_pos.size()));
+        int* ret_tab = ret_double?NULL:INTEGER(ret);
+        double* ret_dbl = ret_double?REAL(ret):NULL;
 
-        R_len_t j = 0;
+        R_xlen_t j = 0;
         if (na_last_int != NA_LOGICAL && !na_last_int) {
             // put NAs first
-            for (std::deque<int>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j)
-                ret_tab[j] = (*it)+1; // 1-based indices
+            for (std::deque<R_xlen_t>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j) {
+                if (ret_double) ret_dbl[j] = (double)((*it)+1); // 1-based indices
+                else ret_tab[j] = (int)((*it)+1);
+            }
         }
 
-        for (std::vector<int>::iterator it=order.begin(); it!=order.end(); ++it, ++j)
-            ret_tab[j] = (*it)+1; // 1-based indices
+        for (std::vector<R_xlen_t>::iterator it=order.begin(); it!=order.end(); ++it, ++j) {
+            if (ret_double) ret_dbl[j] = (double)((*it)+1); // 1-based indices
+            else ret_tab[j] = (int)((*it)+1);
+        }
 
         if (na_last_int != NA_LOGICAL && na_last_int) {
             // put NAs last
-            for (std::deque<int>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j)
-                ret_tab[j] = (*it)+1; // 1-based indices
+            for (std::deque<R_xlen_t>::iterator it=NA_pos.begin(); it!=NA_pos.end(); ++it, ++j) {
+                if (ret_double) ret_dbl[j] = (double)((*it)+1); // 1-based indices
+                else ret_tab[j] = (int)((*it)+1);
+            }
         }
     }
     else {       // (_type == STRI_SORTRANKORDER_RANK)
         // NAs are always preserved, order is increasing
-        STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
-        int* ret_tab = INTEGER(ret);
-        for (R_len_t i=0; i<vectorize_length; ++i)
-            ret_tab[i] = NA_INTEGER;
-
-        R_len_t j_first = 1;   // 1-based indices
-        R_len_t j_min = 1;
-        int last_idx = 0, cur_idx;
-        for (std::vector<int>::iterator it=order.begin(); it!=order.end(); ++it) {
+        STRI__PROTECT(ret = Rf_allocVector(ret_double?REALSXP:INTSXP, vectorize_length));
+        int* ret_tab = ret_double?NULL:INTEGER(ret);
+        double* ret_dbl = ret_double?REAL(ret):NULL;
+        for (R_xlen_t i=0; i<vectorize_length; ++i) {
+            if (ret_double) ret_dbl[i] = NA_REAL;
+            else ret_tab[i] = NA_INTEGER;
+        }
+
+        R_xlen_t j_first = 1;   // 1-based indices
+        R_xlen_t j_min = 1;
+        R_xlen_t last_idx = 0, cur_idx;
+        for (std::vector<R_xlen_t>::iterator it=order.begin(); it!=order.end(); ++it) {
             cur_idx = *it;
 
             if (j_first > 1) {
@@ -240,7 +257,8 @@ SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
             }
 
 
-            ret_tab[cur_idx] = j_min;
+            if (ret_double) ret_dbl[cur_idx] = (double)j_min;
+            else ret_tab[cur_idx] = (int)j_min;
             last_idx = cur_idx;
             j_first++;
         }
@@ -575,13 +593,18 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
  *
  * @param str character vector
  * @param opts_collator passed to stri__ucol_open()
- * @return character vector
+ * @param packed single logical value
+ * @return character vector or a packed raw vector
  *
  * @version 1.4.7 (Davis Vaughan, 2020-07-15)
  * @version 1.6.1 (Marek Gagolewski, 2021-04-29)
  *          output `bytes`-encoded strings
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          `packed` arg
  */
-SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
+SEXP stri_sort_key(SEXP str, SEXP opts_collator, SEXP packed) {
+    bool packed_val = stri__prepare_arg_logical_1_notNA(packed, "packed");
     PROTECT(str = stri__prepare_arg_string(str, "str"));
 
     // call stri__ucol_open after prepare_arg:
@@ -593,8 +616,10 @@ SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
     R_len_t length = LENGTH(str);
     StriContainerUTF16 str_cont(str, length);
 
-    SEXP ret;
-    STRI__PROTECT(ret = Rf_allocVector(STRSXP, length));
+    SEXP ret = R_NilValue;
+    if (!packed_val)
+        STRI__PROTECT(ret = Rf_allocVector(STRSXP, length));
+    StriPackedRaw ret_packed(packed_val?length:0);
 
 //    UErrorCode status = U_ZERO_ERROR;
 
@@ -605,7 +630,8 @@ SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
 
     for (R_len_t i = 0; i < length; ++i) {
         if (str_cont.isNA(i)) {
-            SET_STRING_ELT(ret, i, NA_STRING);
+            if (packed_val) ret_packed.addNA();
+            else            SET_STRING_ELT(ret, i, NA_STRING);
             continue;
         }
 
@@ -631,9 +657,15 @@ SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
         // which we don't want to copy into the R CHARSXP
         R_len_t key_char_size = key_size - 1;
 
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(key_buffer.data(), key_char_size, CE_BYTES));
+        if (packed_val)
+            ret_packed.add(key_buffer.data(), (size_t)key_char_size);
+        else
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(key_buffer.data(), key_char_size, CE_BYTES));
     }
 
+    if (packed_val)
+        STRI__PROTECT(ret = ret_packed.toR());
+
     if (col) {
         ucol_close(col);
         col = NULL;
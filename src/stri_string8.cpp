@@ -191,7 +191,15 @@ void String8::replaceAllAtPos(R_len_t buf_size,
     this->m_str = new char[buf_size+1];
     this->m_n = buf_size;
     this->m_memalloc = true;
-    this->m_isASCII = true; /* TO DO */
+    if (this->m_isASCII && occurrences.size() > 0) {
+        // the result is in ASCII iff the replacement string is
+        for (R_len_t k=0; k<replacement_cur_n; ++k) {
+            if ((unsigned char)replacement_cur_s[k] > ASCII_MAXCHARCODE) {
+                this->m_isASCII = false;
+                break;
+            }
+        }
+    }
 
     R_len_t buf_used = 0;
     R_len_t jlast = 0;
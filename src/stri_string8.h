@@ -68,6 +68,10 @@
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  *          new field: m_isASCII
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          m_isASCII is kept up-to-date by replaceAllAtPos();
+ *          new method: countWidth()
  */
 class String8  {
 
@@ -76,7 +80,7 @@ private:
     char* m_str;      ///< character data in UTF-8, NULL denotes NA
     R_len_t m_n;      ///< string length (in bytes), not including NUL
     bool m_memalloc;  ///< should the memory be freed at the end?
-    bool m_isASCII;   ///< ASCII or UTF-8?  TODO: is it used anywhere?
+    bool m_isASCII;   ///< ASCII or UTF-8? (enables byte-level fast paths)
 
 
 public:
@@ -203,6 +207,20 @@ public:
     }
 
 
+    /** The display width (see \code{stri_width}) */
+    inline R_len_t countWidth() const
+    {
+#ifndef NDEBUG
+        if (isNA())
+            throw StriException("String8::isNA() in countWidth()");
+#endif
+        if (m_isASCII)
+            return stri__width_string_ascii(m_str, m_n);
+        else
+            return stri__width_string(m_str, m_n);
+    }
+
+
     /**
      *
      * @version 0.4-1 (Marek Gagolewski, 2014-12-07)
@@ -49,6 +49,9 @@
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  *          Use malloc+realloc
+ *
+ * @version 1.8.8 (2026-10-19)
+ *          new method: grow()
  */
 class String8buf  {
 
@@ -147,6 +150,20 @@ public:
         }
     }
 
+    /** increase buffer size geometrically (amortised O(1) appends);
+     * the existing buffer content is retained
+     *
+     * @param size minimal new size-1
+     *
+     * @version 1.8.8 (2026-10-19)
+     */
+    inline void grow(size_t size)
+    {
+        if (this->m_size > size)
+            return;
+        resize((size < 2*this->m_size)?(2*this->m_size):size, true);
+    }
+
     /** Replace substrings with a given replacement string
      *
      * TODO: How does this relate to String8::replaceAllAtPos? Is it redundant?
@@ -32,6 +32,10 @@
 
 #include "stri_stringi.h"
 #include "stri_callables.h"
+#include "stri_altrep.h"
+#include "stri_ucnv.h"
+#include "stri_parallel.h"
+#include "stri_time_cache.h"
 #include <cstring>
 #include <cstdlib>
 #include <unicode/uclean.h>
@@ -53,6 +57,7 @@
  * this is generated by the STRI__MK_CALL macro.
  */
 const R_CallMethodDef cCallMethods[] = {
+    STRI__MK_CALL("C_stri_cache_info",                   stri_cache_info,                 1),
 // STRI__MK_CALL("C_stri_c_posixst",                    stri_c_posixst,                  1),  // internal
     STRI__MK_CALL("C_stri_cmp_eq",                       stri_cmp_eq,                     2),
     STRI__MK_CALL("C_stri_cmp_neq",                      stri_cmp_neq,                    2),
@@ -83,7 +88,7 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_dup",                          stri_dup,                        2),
     STRI__MK_CALL("C_stri_duplicated",                   stri_duplicated,                 3),
     STRI__MK_CALL("C_stri_duplicated_any",               stri_duplicated_any,             3),
-    STRI__MK_CALL("C_stri_enc_detect",                   stri_enc_detect,                 2),
+    STRI__MK_CALL("C_stri_enc_detect",                   stri_enc_detect,                 6),
     STRI__MK_CALL("C_stri_enc_detect2",                  stri_enc_detect2,                2),
     STRI__MK_CALL("C_stri_enc_isutf8",                   stri_enc_isutf8,                 1),
     STRI__MK_CALL("C_stri_enc_isutf16le",                stri_enc_isutf16le,              1),
@@ -149,10 +154,16 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_match_last_regex",             stri_match_last_regex,           4),
     STRI__MK_CALL("C_stri_match_all_regex",              stri_match_all_regex,            5),
     STRI__MK_CALL("C_stri_numbytes",                     stri_numbytes,                   1),
+    STRI__MK_CALL("C_stri_options_get",                  stri_options_get,                0),
+    STRI__MK_CALL("C_stri_options_set",                  stri_options_set,                1),
     STRI__MK_CALL("C_stri_order",                        stri_order,                      4),
     STRI__MK_CALL("C_stri_rank",                         stri_rank,                       2),
+    STRI__MK_CALL("C_stri_read_lines_close",             stri_read_lines_close,           1),
+    STRI__MK_CALL("C_stri_read_lines_next",              stri_read_lines_next,            3),
+    STRI__MK_CALL("C_stri_read_lines_open",              stri_read_lines_open,            2),
+    STRI__MK_CALL("C_stri_read_raw",                     stri_read_raw,                   1),
     STRI__MK_CALL("C_stri_sort",                         stri_sort,                       4),
-    STRI__MK_CALL("C_stri_sort_key",                     stri_sort_key,                   2),
+    STRI__MK_CALL("C_stri_sort_key",                     stri_sort_key,                   3),
     STRI__MK_CALL("C_stri_pad",                          stri_pad,                        5),
     STRI__MK_CALL("C_stri_prepare_arg_string",           stri_prepare_arg_string,         2),
     STRI__MK_CALL("C_stri_prepare_arg_double",           stri_prepare_arg_double,         2),
@@ -205,6 +216,10 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_subset_coll_replacement",      stri_subset_coll_replacement,    5),
     STRI__MK_CALL("C_stri_subset_fixed_replacement",     stri_subset_fixed_replacement,   5),
     STRI__MK_CALL("C_stri_subset_regex_replacement",     stri_subset_regex_replacement,   5),
+    STRI__MK_CALL("C_stri_test_brkiter_ascii",           stri_test_brkiter_ascii,         2),
+    STRI__MK_CALL("C_stri_test_datetime_grego",          stri_test_datetime_grego,        1),
+    STRI__MK_CALL("C_stri_test_datetime_iso",            stri_test_datetime_iso,          5),
+    STRI__MK_CALL("C_stri_test_encode_kernels",          stri_test_encode_kernels,        3),
     STRI__MK_CALL("C_stri_test_Rmark",                   stri_test_Rmark,                 1),
     STRI__MK_CALL("C_stri_test_returnasis",              stri_test_returnasis,            1),
     STRI__MK_CALL("C_stri_test_UnicodeContainer16",      stri_test_UnicodeContainer16,    1),
@@ -236,6 +251,7 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_unescape_unicode",             stri_unescape_unicode,           1),
     STRI__MK_CALL("C_stri_unique",                       stri_unique,                     2),
     STRI__MK_CALL("C_stri_width",                        stri_width,                      1),
+    STRI__MK_CALL("C_stri_write_lines",                  stri_write_lines,                4),
     STRI__MK_CALL("C_stri_wrap",                         stri_wrap,                      10),
     // the list must be NULL-terminated:
     {NULL,                           NULL,                  0}
@@ -310,7 +326,10 @@ extern "C" void R_init_stringi(DllInfo* dll)
         if (U_FAILURE(status)) Rf_error("ICU init failed: %s", u_errorName(status));
     }
 
+    stri__utf8_select_kernels();
+
     R_registerRoutines(dll, NULL, cCallMethods, NULL, NULL);
+    stri__altrep_init(dll);
     R_useDynamicSymbols(dll, (Rboolean)FALSE);
 #if defined(R_VERSION) && R_VERSION >= R_Version(3, 0, 0)
     R_forceSymbols(dll, (Rboolean)TRUE);
@@ -344,6 +363,12 @@ extern "C" void R_init_stringi(DllInfo* dll)
  */
 extern "C" void  R_unload_stringi(DllInfo*)
 {
+    StriParallel::shutdown();
+    StriUcnv::clearPool();  // before u_cleanup
+    stri__time_cache_clear();
+    stri__transliterator_cache().clear();
+    stri__brkiter_cache().clear();
+
     // see http://bugs.icu-project.org/trac/ticket/10897
     // and https://github.com/Rexamine/stringi/issues/78
     u_cleanup();
@@ -46,14 +46,19 @@ void    stri__set_names(SEXP object, R_len_t numnames, ...);
 SEXP    stri__make_character_vector_char_ptr(R_len_t numnames, ...);
 SEXP    stri__make_character_vector_UnicodeString_ptr(R_len_t numnames, ...);
 R_len_t stri__recycling_rule(bool enableWarning, int n, ...);
-SEXP    stri__vector_NA_integers(R_len_t howmany);
-SEXP    stri__vector_NA_strings(R_len_t howmany);
-SEXP    stri__vector_empty_strings(R_len_t howmany);
+R_xlen_t stri__recycling_rule_xlen(bool enableWarning, int n, ...);
+SEXP    stri__vector_NA_integers(R_xlen_t howmany);
+SEXP    stri__vector_NA_strings(R_xlen_t howmany);
+SEXP    stri__vector_empty_strings(R_xlen_t howmany);
 SEXP    stri__emptyList();
 SEXP    stri__matrix_NA_INTEGER(R_len_t nrow, R_len_t ncol, int filler=NA_INTEGER);  // TODO: other ones can be generalised too
 SEXP    stri__matrix_NA_STRING(R_len_t nrow, R_len_t ncol);
 int     stri__match_arg(const char* option, const char** set);
 
+// options.cpp:
+bool stri__getopt_lazy_substrings();
+int  stri__getopt_threads();
+
 // collator.cpp:
 struct UCollator;
 UCollator* stri__ucol_open(SEXP opts_collator);
@@ -63,8 +68,22 @@ R_len_t stri__numbytes_max(SEXP str);
 int     stri__width_char(UChar32 c);
 int     stri__width_char_with_context(UChar32 c, UChar32 p, bool& reset);
 int     stri__width_string(const char* s, int n, int max_width=NA_INTEGER);
+int     stri__width_string_ascii(const char* s, int n, int max_width=NA_INTEGER);
 int     stri__length_string(const char* s, int n, int max_length=NA_INTEGER);
 
+// utf8.cpp:
+void    stri__utf8_select_kernels();
+R_len_t stri__utf8_ascii_prefix(const char* s, R_len_t n);
+R_len_t stri__utf8_count_codepoints(const char* s, R_len_t n);
+R_len_t stri__utf8_invalid_offset(const char* s, R_len_t n, R_len_t* nmultibyte=NULL);
+R_len_t stri__utf8_decode(const char* s, R_len_t n, UChar32* out);
+R_len_t stri__utf8_to_utf16(const char* s, R_len_t n, char* out, bool big_endian);
+R_len_t stri__utf8_to_utf32(const char* s, R_len_t n, char* out, bool big_endian);
+R_len_t stri__utf16_to_utf8(const char* s, R_len_t n, char* out, bool big_endian);
+R_len_t stri__utf32_to_utf8(const char* s, R_len_t n, char* out, bool big_endian);
+R_len_t stri__sbcs_to_utf8(const char* s, R_len_t n, const UChar32* table, char* out);
+R_len_t stri__sbcs_to_utf16(const char* s, R_len_t n, const UChar32* table, UChar* out);
+
 // prepare_arg.cpp:
 SEXP stri__prepare_arg_string_1(SEXP x,  const char* argname);
 SEXP stri__prepare_arg_double_1(SEXP x,  const char* argname, bool factors_as_strings=true);
@@ -33,6 +33,7 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8_indexable.h"
 #include "stri_string8buf.h"
+#include "stri_altrep.h"
 #include <stdexcept>
 
 
@@ -46,9 +47,11 @@
  * @version 1.7.1 (Marek Gagolewski, 2021-06-30) allow (from,length) matrices
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-07-08) use_matrix
+ *
+ * @version 1.8.8 (2026-10-19) long vector support
  */
 R_len_t stri__sub_prepare_from_to_length(SEXP& from, SEXP& to, SEXP& length,
-        R_len_t& from_len, R_len_t& to_len, R_len_t& length_len,
+        R_xlen_t& from_len, R_xlen_t& to_len, R_xlen_t& length_len,
         int*& from_tab, int*& to_tab, int*& length_tab, bool use_matrix_1)
 {
     R_len_t sub_protected = 0;
@@ -88,13 +91,13 @@ R_len_t stri__sub_prepare_from_to_length(SEXP& from, SEXP& to, SEXP& length,
         UNPROTECT(1);  // t
 
         if (fromlength_matrix) {
-            from_len      = LENGTH(from)/2;
+            from_len      = XLENGTH(from)/2;
             length_len    = from_len;
             from_tab      = INTEGER(from);
             length_tab    = from_tab+from_len;
         }
         else {
-            from_len      = LENGTH(from)/2;
+            from_len      = XLENGTH(from)/2;
             to_len        = from_len;
             from_tab      = INTEGER(from);
             to_tab        = from_tab+from_len;
@@ -105,18 +108,18 @@ R_len_t stri__sub_prepare_from_to_length(SEXP& from, SEXP& to, SEXP& length,
     else if (Rf_isNull(length)) {
         sub_protected++;
         PROTECT(to    = stri__prepare_arg_integer(to, "to"));
-        from_len      = LENGTH(from);
+        from_len      = XLENGTH(from);
         from_tab      = INTEGER(from);
-        to_len        = LENGTH(to);
+        to_len        = XLENGTH(to);
         to_tab        = INTEGER(to);
         //PROTECT(length); /* fake - not to provoke stack imbalance */
     }
     else {
         sub_protected++;
         PROTECT(length= stri__prepare_arg_integer(length, "length"));
-        from_len      = LENGTH(from);
+        from_len      = XLENGTH(from);
         from_tab      = INTEGER(from);
-        length_len    = LENGTH(length);
+        length_len    = XLENGTH(length);
         length_tab    = INTEGER(length);
         //PROTECT(to); /* fake - not to provoke stack imbalance */
     }
@@ -133,7 +136,7 @@ R_len_t stri__sub_prepare_from_to_length(SEXP& from, SEXP& to, SEXP& length,
 /**
  * used both in stri_sub and stri_sub_replacement
  */
-inline void stri__sub_get_indices(StriContainerUTF8_indexable& str_cont, R_len_t& i,
+inline void stri__sub_get_indices(StriContainerUTF8_indexable& str_cont, R_xlen_t& i,
                                   R_len_t& cur_from,  R_len_t& cur_to,
                                   R_len_t& cur_from2, R_len_t& cur_to2)
 {
@@ -196,6 +199,12 @@ inline void stri__sub_get_indices(StriContainerUTF8_indexable& str_cont, R_len_t
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-07-08)
  *    use_matrix, ignore_negative_length
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    use StriSubstrings (lazy results if requested)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_sub(SEXP str, SEXP from, SEXP to, SEXP length, SEXP use_matrix, SEXP ignore_negative_length)
 {
@@ -203,10 +212,10 @@ SEXP stri_sub(SEXP str, SEXP from, SEXP to, SEXP length, SEXP use_matrix, SEXP i
     bool use_matrix_1 = stri__prepare_arg_logical_1_notNA(use_matrix, "use_matrix");
     bool ignore_negative_length_1 = stri__prepare_arg_logical_1_notNA(ignore_negative_length, "ignore_negative_length");
 
-    R_len_t str_len       = LENGTH(str);
-    R_len_t from_len      = 0;
-    R_len_t to_len        = 0;
-    R_len_t length_len    = 0;
+    R_xlen_t str_len      = XLENGTH(str);
+    R_xlen_t from_len     = 0;
+    R_xlen_t to_len       = 0;
+    R_xlen_t length_len   = 0;
     int* from_tab         = 0;
     int* to_tab           = 0;
     int* length_tab       = 0;
@@ -215,7 +224,7 @@ SEXP stri_sub(SEXP str, SEXP from, SEXP to, SEXP length, SEXP use_matrix, SEXP i
                              stri__sub_prepare_from_to_length(from, to, length,
                                      from_len, to_len, length_len, from_tab, to_tab, length_tab, use_matrix_1);
 
-    R_len_t vectorize_len = stri__recycling_rule(true, 3,
+    R_xlen_t vectorize_len = stri__recycling_rule_xlen(true, 3,
                             str_len, from_len, (to_len>length_len)?to_len:length_len);
 
     if (vectorize_len <= 0) {
@@ -225,28 +234,29 @@ SEXP stri_sub(SEXP str, SEXP from, SEXP to, SEXP length, SEXP use_matrix, SEXP i
 
     STRI__ERROR_HANDLER_BEGIN(sub_protected)
     StriContainerUTF8_indexable str_cont(str, vectorize_len);
-    SEXP ret;
-    STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_len));
+    StriSubstrings ret_sub(vectorize_len,
+        StriSubstrings::useLazy(vectorize_len, str_cont.isReadOnly()));
+    STRI__PROTECT(ret_sub.getData());
 
-    R_len_t num_negative_length = 0;
-    for (R_len_t i = str_cont.vectorize_init();
+    R_xlen_t num_negative_length = 0;
+    for (R_xlen_t i = str_cont.vectorize_init();
             i != str_cont.vectorize_end();
             i = str_cont.vectorize_next(i))
     {
         R_len_t cur_from     = from_tab[i % from_len];
         R_len_t cur_to       = (to_tab)?to_tab[i % to_len]:length_tab[i % length_len];
         if (str_cont.isNA(i) || cur_from == NA_INTEGER || cur_to == NA_INTEGER) {
-            SET_STRING_ELT(ret, i, NA_STRING);
+            ret_sub.setNA(i);
             continue;
         }
 
         if (length_tab) {
             if (cur_to == 0) {
-                SET_STRING_ELT(ret, i, R_BlankString);
+                ret_sub.set(i, str_cont.getSource(i), str_cont.get(i).c_str(), 0);
                 continue;
             }
             else if (cur_to < 0) {
-                SET_STRING_ELT(ret, i, NA_STRING);
+                ret_sub.setNA(i);
                 num_negative_length++;
                 continue;
             }
@@ -263,22 +273,25 @@ SEXP stri_sub(SEXP str, SEXP from, SEXP to, SEXP length, SEXP use_matrix, SEXP i
         stri__sub_get_indices(str_cont, i, cur_from, cur_to, cur_from2, cur_to2);
 
         if (cur_to2 > cur_from2) { // just copy
-            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(str_cur_s+cur_from2, cur_to2-cur_from2, CE_UTF8));
+            ret_sub.set(i, str_cont.getSource(i), str_cur_s+cur_from2, cur_to2-cur_from2);
         }
         else {
             // maybe a warning here?
-            SET_STRING_ELT(ret, i, Rf_mkCharLen(NULL, 0));
+            ret_sub.set(i, str_cont.getSource(i), str_cur_s, 0);
         }
     }
 
+    SEXP ret;
+    STRI__PROTECT(ret = ret_sub.toR());
+
     if (num_negative_length > 0 && ignore_negative_length_1) {
         // stringx: ignore items corresponding to length<0
         STRI_ASSERT(length_tab)
 
         SEXP ret_old = ret;
         STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_len-num_negative_length));
-        R_len_t k = 0;
-        for (R_len_t i = str_cont.vectorize_init();
+        R_xlen_t k = 0;
+        for (R_xlen_t i = str_cont.vectorize_init();
             i != str_cont.vectorize_end();
             i = str_cont.vectorize_next(i))
         {
@@ -348,6 +361,9 @@ SEXP stri_sub(SEXP str, SEXP from, SEXP to, SEXP length, SEXP use_matrix, SEXP i
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-07-08)
  *    use_matrix
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    long vector support
  */
 SEXP stri_sub_replacement(SEXP str, SEXP from, SEXP to, SEXP length, SEXP omit_na, SEXP value, SEXP use_matrix)
 {
@@ -356,11 +372,11 @@ SEXP stri_sub_replacement(SEXP str, SEXP from, SEXP to, SEXP length, SEXP omit_n
     bool omit_na_1 = stri__prepare_arg_logical_1_notNA(omit_na, "omit_na");
     bool use_matrix_1 = stri__prepare_arg_logical_1_notNA(use_matrix, "use_matrix");
 
-    R_len_t value_len     = LENGTH(value);
-    R_len_t str_len       = LENGTH(str);
-    R_len_t from_len      = 0; // see below
-    R_len_t to_len        = 0; // see below
-    R_len_t length_len    = 0; // see below
+    R_xlen_t value_len    = XLENGTH(value);
+    R_xlen_t str_len      = XLENGTH(str);
+    R_xlen_t from_len     = 0; // see below
+    R_xlen_t to_len       = 0; // see below
+    R_xlen_t length_len   = 0; // see below
     int* from_tab         = 0; // see below
     int* to_tab           = 0; // see below
     int* length_tab       = 0; // see below
@@ -369,7 +385,7 @@ SEXP stri_sub_replacement(SEXP str, SEXP from, SEXP to, SEXP length, SEXP omit_n
                              stri__sub_prepare_from_to_length(from, to, length,
                                      from_len, to_len, length_len, from_tab, to_tab, length_tab, use_matrix_1);
 
-    R_len_t vectorize_len = stri__recycling_rule(true, 4,
+    R_xlen_t vectorize_len = stri__recycling_rule_xlen(true, 4,
                             str_len, value_len, from_len, (to_len>length_len)?to_len:length_len);
 
     if (vectorize_len <= 0) {
@@ -384,7 +400,7 @@ SEXP stri_sub_replacement(SEXP str, SEXP from, SEXP to, SEXP length, SEXP omit_n
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_len));
     String8buf buf(0); // @TODO: estimate bufsize a priori
 
-    for (R_len_t i = str_cont.vectorize_init();
+    for (R_xlen_t i = str_cont.vectorize_init();
             i != str_cont.vectorize_end();
             i = str_cont.vectorize_next(i))
     {
@@ -563,11 +579,11 @@ SEXP stri__sub_replacement_all_single(
     // curs is a CHARSXP in UTF-8
 
     PROTECT(value = stri_enc_toutf8(value, Rf_ScalarLogical(FALSE), Rf_ScalarLogical(FALSE)));
-    R_len_t value_len     = LENGTH(value);
+    R_xlen_t value_len    = XLENGTH(value);
 
-    R_len_t from_len      = 0; // see below
-    R_len_t to_len        = 0; // see below
-    R_len_t length_len    = 0; // see below
+    R_xlen_t from_len     = 0; // see below
+    R_xlen_t to_len       = 0; // see below
+    R_xlen_t length_len   = 0; // see below
     int* from_tab         = 0; // see below
     int* to_tab           = 0; // see below
     int* length_tab       = 0; // see below
@@ -576,7 +592,7 @@ SEXP stri__sub_replacement_all_single(
                             stri__sub_prepare_from_to_length(from, to, length,
                                     from_len, to_len, length_len, from_tab, to_tab, length_tab, use_matrix_1);
 
-    R_len_t vectorize_len = stri__recycling_rule(true, 2, // does not care about value_len
+    R_xlen_t vectorize_len = stri__recycling_rule_xlen(true, 2, // does not care about value_len
                             from_len, (to_len>length_len)?to_len:length_len);
 
     if (vectorize_len <= 0) { // "nothing" is being replaced -> return the input as-is
@@ -594,7 +610,7 @@ SEXP stri__sub_replacement_all_single(
 
     // first check for NAs....
     if (!omit_na_1) {
-        for (R_len_t i=0; i<vectorize_len; ++i) {
+        for (R_xlen_t i=0; i<vectorize_len; ++i) {
             R_len_t cur_from     = from_tab[i % from_len];
             R_len_t cur_to       = (to_tab)?to_tab[i % to_len]:length_tab[i % length_len];
             if (cur_from == NA_INTEGER || cur_to == NA_INTEGER) {
@@ -604,7 +620,7 @@ SEXP stri__sub_replacement_all_single(
             }
         }
 
-        for (R_len_t i=0; i<vectorize_len; ++i) {
+        for (R_xlen_t i=0; i<vectorize_len; ++i) {
             if (STRING_ELT(value, i%value_len) == NA_STRING) {
                 UNPROTECT(sub_protected);
                 return NA_STRING;
@@ -632,7 +648,7 @@ SEXP stri__sub_replacement_all_single(
     R_len_t num_replaced = 0;
     R_len_t last_pos = 0;
     R_len_t byte_pos = 0;
-    for (R_len_t i=0; i<vectorize_len; ++i) {
+    for (R_xlen_t i=0; i<vectorize_len; ++i) {
         R_len_t cur_from     = from_tab[i % from_len];
         R_len_t cur_to       = (to_tab)?to_tab[i % to_len]:length_tab[i % length_len];
 
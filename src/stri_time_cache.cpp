@@ -0,0 +1,85 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_time_cache.h"
+
+
+/* max number of prototypes kept in each cache */
+#define STRI__TIME_CACHE_MAX_SIZE 64
+
+
+static StriICUCache<TimeZone>   stri__timezone_cache_obj(STRI__TIME_CACHE_MAX_SIZE);
+static StriICUCache<Calendar>   stri__calendar_cache_obj(STRI__TIME_CACHE_MAX_SIZE);
+static StriICUCache<DateFormat> stri__date_format_cache_obj(STRI__TIME_CACHE_MAX_SIZE);
+
+
+/** Time zones, keyed by their IDs (UTF-8)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriICUCache<TimeZone>& stri__timezone_cache()
+{
+    return stri__timezone_cache_obj;
+}
+
+
+/** Calendars (with an arbitrary time zone), keyed by locale
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriICUCache<Calendar>& stri__calendar_cache()
+{
+    return stri__calendar_cache_obj;
+}
+
+
+/** Date-time formatters, keyed by format and locale
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriICUCache<DateFormat>& stri__date_format_cache()
+{
+    return stri__date_format_cache_obj;
+}
+
+
+/** Free all the cached date-time objects and reset the statistics
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void stri__time_cache_clear()
+{
+    stri__timezone_cache_obj.clear();
+    stri__calendar_cache_obj.clear();
+    stri__date_format_cache_obj.clear();
+}
@@ -34,8 +34,16 @@
 #include "stri_container_utf8.h"
 #include "stri_container_double.h"
 #include "stri_container_integer.h"
+#include "stri_time_cache.h"
+#include "stri_time_gregorian.h"
+#include "stri_parallel.h"
 #include <unicode/calendar.h>
 #include <unicode/gregocal.h>
+#include <unicode/basictz.h>
+#include <unicode/tztrans.h>
+#include <string>
+#include <vector>
+#include <algorithm>
 
 
 /** Set POSIXct class on a given object
@@ -73,17 +81,30 @@ SEXP stri_datetime_now()
 
 
 /** Get calendar
+ *
+ * The time zone of the returned calendar is unspecified,
+ * call adoptTimeZone().
  *
  * @return Calendar
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-07)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    clone the calendars from the cache
  */
 Calendar* stri__get_calendar(const char* locale_val)
 {
+    std::string cal_key((locale_val)?locale_val:uloc_getDefault());
+    Calendar* cal = stri__calendar_cache().get(cal_key);
+    if (cal) return cal;
+
     UErrorCode status = U_ZERO_ERROR;
-    Calendar* cal = Calendar::createInstance(Locale::createFromName(locale_val), status);
+    cal = Calendar::createInstance(Locale::createFromName(locale_val), status);
     STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
+    if (status == U_ZERO_ERROR)  // do not cache if a warning is to be given
+        stri__calendar_cache().put(cal_key, cal);
+
     // NOTE: unfortunately, in ICU 74.1 U_USING_DEFAULT_WARNING is never emitted
     if (status == U_USING_DEFAULT_WARNING && cal && locale_val) {
         UErrorCode status2 = U_ZERO_ERROR;
@@ -97,6 +118,135 @@ Calendar* stri__get_calendar(const char* locale_val)
 
 
 
+/* the range of UTC times (ms) dealt with natively; the offsets (less than
+   a day) cannot push the local times out of [STRI__GREGO_MIN_YEAR, STRI__GREGO_MAX_YEAR] */
+#define STRI__GREGO_MIN_TIME ((stri__grego_days_from_civil(STRI__GREGO_MIN_YEAR, 1, 1)+1)*STRI__GREGO_MILLIS_PER_DAY)
+#define STRI__GREGO_MAX_TIME ((stri__grego_days_from_civil(STRI__GREGO_MAX_YEAR+1, 1, 1)-1)*STRI__GREGO_MILLIS_PER_DAY)
+
+
+/** Local time of day in milliseconds, as UCAL_MILLISECONDS_IN_DAY
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static inline int32_t stri__grego_millis_in_day(double local)
+{
+    double days = floor(local/STRI__GREGO_MILLIS_PER_DAY);
+    return (int32_t)(floor(local) - days*STRI__GREGO_MILLIS_PER_DAY);
+}
+
+
+/** Date-time arithmetic in the Gregorian calendar; gives the same
+ *  results as Calendar::add with the default (lenient, UCAL_WALLTIME_LAST)
+ *  settings
+ *
+ * Thread-safe.
+ *
+ * @param offsets time zone offsets
+ * @param t milliseconds since the UNIX epoch
+ * @param amount value to add
+ * @param units_cur index in {"years", "months", "weeks", "days", "hours",
+ *    "minutes", "seconds", "milliseconds"}
+ * @param result [out]
+ * @return false if ICU should be used instead
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__datetime_add_grego(
+    const StriZoneOffsetTable& offsets, double t, int32_t amount, int units_cur,
+    double& result
+) {
+    if (!(t >= STRI__GREGO_MIN_TIME && t <= STRI__GREGO_MAX_TIME))
+        return false;
+
+    if (amount == 0) {
+        result = t;
+        return true;
+    }
+
+    double delta = amount;
+    switch (units_cur) {
+        case 0:  // years
+        case 1: {  // months
+            // set(field, get(field)+amount), pinField(UCAL_DAY_OF_MONTH),
+            // the time of day stays the same
+            if (!offsets.covers(t)) return false;
+            double local = t + offsets.getOffset(t);
+            int32_t millis = stri__grego_millis_in_day(local);
+            int32_t y, m, d;
+            stri__grego_civil_from_days((int32_t)floor(local/STRI__GREGO_MILLIS_PER_DAY), y, m, d);
+
+            double new_y = y, new_m = m;
+            if (units_cur == 0)
+                new_y += amount;
+            else {
+                double m0 = (m-1) + (double)amount;
+                new_y += floor(m0/12.0);
+                new_m = m0 - 12.0*floor(m0/12.0) + 1;
+            }
+            if (new_y < STRI__GREGO_MIN_YEAR || new_y > STRI__GREGO_MAX_YEAR)
+                return false;
+
+            int32_t dim = stri__grego_days_in_month((int32_t)new_y, (int32_t)new_m);
+            if (d > dim) d = dim;
+            local = stri__grego_days_from_civil((int32_t)new_y, (int32_t)new_m, d)*STRI__GREGO_MILLIS_PER_DAY + millis;
+
+            int32_t offset;
+            if (!offsets.getOffsetFromLocal(local, offset)) return false;
+            result = local - offset;
+            return true;
+        }
+
+        case 2:  // weeks
+        case 3: {  // days
+            // as in Calendar::add: keep the wall time invariant
+            delta *= ((units_cur == 2) ? 7.0 : 1.0)*STRI__GREGO_MILLIS_PER_DAY;
+            double t2 = t + delta;
+            if (!offsets.covers(t) || !offsets.covers(t2)) return false;
+
+            int32_t prev_offset = offsets.getOffset(t);
+            int32_t prev_wall = stri__grego_millis_in_day(t + prev_offset);
+            int32_t new_offset = offsets.getOffset(t2);
+            int32_t new_wall = stri__grego_millis_in_day(t2 + new_offset);
+            result = t2;
+            if (new_wall != prev_wall && new_offset != prev_offset) {
+                int32_t adj = prev_offset - new_offset;
+                adj = (adj >= 0) ? adj%86400000 : -((-adj)%86400000);
+                if (adj != 0) {
+                    double t3 = t2 + adj;
+                    if (!offsets.covers(t3)) return false;
+                    result = t3;
+                    new_wall = stri__grego_millis_in_day(t3 + offsets.getOffset(t3));
+                }
+                if (new_wall != prev_wall && adj < 0)  // UCAL_WALLTIME_LAST
+                    result = t2;
+            }
+            return true;
+        }
+
+        case 4:  // hours
+            delta *= 3600000.0;
+            break;
+
+        case 5:  // minutes
+            delta *= 60000.0;
+            break;
+
+        case 6:  // seconds
+            delta *= 1000.0;
+            break;
+
+        case 7:  // milliseconds
+            break;
+
+        default:
+            return false;
+    }
+
+    result = t + delta;
+    return true;
+}
+
+
 /** Date-time arithmetic
  *
  * @param time
@@ -113,6 +263,10 @@ Calendar* stri__get_calendar(const char* locale_val)
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-07)
  *     #476: Warn when falling back to the root locale, make C==en_US_POSIX
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     Gregorian calendar: native arithmetic with tabulated time zone
+ *     offsets, multithreaded; ICU is used for other calendars
  */
 SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
 {
@@ -176,7 +330,55 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(REALSXP, vectorize_length));
     double* ret_val = REAL(ret);
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+
+    // the Gregorian calendar is dealt with natively; the offsets are
+    // tabulated for the range of times that we may need
+    bool grego = (strcmp(cal->getType(), "gregorian") == 0);
+    StriZoneOffsetTable offsets;
+    if (grego && units_cur <= 3) {
+        const double unit_min[] = {365.0, 28.0, 7.0, 1.0};  // days
+        const double unit_max[] = {366.0, 31.0, 7.0, 1.0};
+        const double margin = 3.0*STRI__GREGO_MILLIS_PER_DAY;
+        double t_min = R_PosInf, t_max = R_NegInf;
+        for (R_len_t i=0; i<vectorize_length; ++i) {
+            if (time_cont.isNA(i) || value_cont.isNA(i)) continue;
+            double t = time_cont.get(i)*1000.0;
+            double shift1 = value_cont.get(i)*unit_min[units_cur]*STRI__GREGO_MILLIS_PER_DAY;
+            double shift2 = value_cont.get(i)*unit_max[units_cur]*STRI__GREGO_MILLIS_PER_DAY;
+            t_min = std::min(t_min, t + std::min(0.0, std::min(shift1, shift2)) - margin);
+            t_max = std::max(t_max, t + std::max(0.0, std::max(shift1, shift2)) + margin);
+        }
+        t_min = std::max(t_min, STRI__GREGO_MIN_TIME - margin);
+        t_max = std::min(t_max, STRI__GREGO_MAX_TIME + margin);
+        offsets.prepare(&cal->getTimeZone(), t_min, t_max);  // covers nothing on failure
+    }
+
+    int nworkers = 1;
+    std::vector< std::vector<R_len_t> > deferred(1);  // to be dealt with by ICU
+    if (grego) {
+        nworkers = StriParallel::getNumWorkers(vectorize_length);
+        deferred.resize(nworkers);
+        StriParallel::run(vectorize_length, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int worker) {
+                for (R_xlen_t i=from; i<to; ++i) {
+                    if (time_cont.isNA(i) || value_cont.isNA(i))
+                        ret_val[i] = NA_REAL;
+                    else if (stri__datetime_add_grego(offsets, time_cont.get(i)*1000.0,
+                            value_cont.get(i), units_cur, ret_val[i]))
+                        ret_val[i] /= 1000.0;
+                    else
+                        deferred[worker].push_back((R_len_t)i);
+                }
+            });
+    }
+    else {
+        deferred[0].reserve(vectorize_length);
+        for (R_len_t i=0; i<vectorize_length; ++i)
+            deferred[0].push_back(i);
+    }
+
+    for (int w=0; w<nworkers; ++w) for (size_t k=0; k<deferred[w].size(); ++k) {
+        R_len_t i = deferred[w][k];
         if (time_cont.isNA(i) || value_cont.isNA(i)) {
             ret_val[i] = NA_REAL;
             continue;
@@ -219,6 +421,174 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
 }
 
 
+#define STRI__FIELDS_NUM 14
+
+
+/** Get values of date-time fields via ICU, see stri_datetime_fields
+ *
+ * @param cal calendar with the time already set
+ * @param ret_tab STRI__FIELDS_NUM arrays to store the results in
+ * @param i index
+ *
+ * @version 1.8.8 (2026-10-19) refactored from stri_datetime_fields
+ */
+static void stri__datetime_fields_icu(Calendar* cal, int** ret_tab, R_len_t i)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
+        UCalendarDateFields units_field;
+        switch (j) {
+        case 0:
+            units_field = UCAL_EXTENDED_YEAR;
+            break;
+        case 1:
+            units_field = UCAL_MONTH;
+            break;
+        case 2:
+            units_field = UCAL_DAY_OF_MONTH;
+            break;
+        case 3:
+            units_field = UCAL_HOUR_OF_DAY;
+            break;
+        case 4:
+            units_field = UCAL_MINUTE;
+            break;
+        case 5:
+            units_field = UCAL_SECOND;
+            break;
+        case 6:
+            units_field = UCAL_MILLISECOND;
+            break;
+        case 7:
+            units_field = UCAL_WEEK_OF_YEAR;
+            break;
+        case 8:
+            units_field = UCAL_WEEK_OF_MONTH;
+            break;
+        case 9:
+            units_field = UCAL_DAY_OF_YEAR;
+            break;
+        case 10:
+            units_field = UCAL_DAY_OF_WEEK;
+            break;
+        case 11:
+            units_field = UCAL_HOUR;
+            break;
+        case 12:
+            units_field = UCAL_AM_PM;
+            break;
+        case 13:
+            units_field = UCAL_ERA;
+            break;
+        default:
+            throw StriException(MSG__INCORRECT_MATCH_OPTION, "units");
+        }
+        //UCAL_IS_LEAP_MONTH
+        //UCAL_MILLISECONDS_IN_DAY -> SecondsInDay
+
+        // UCAL_AM_PM -> "AM" or "PM" (localized? or factor?+index in stri_datetime_symbols) add arg use_symbols????
+        // UCAL_DAY_OF_WEEK -> (localized? or factor?) SUNDAY, MONDAY
+        // UCAL_DAY_OF_YEAR '
+
+        // isWekend
+
+        status = U_ZERO_ERROR;
+        ret_tab[j][i] = cal->get(units_field, status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+        if (units_field == UCAL_MONTH)      ++ret_tab[j][i]; // month + 1
+        else if (units_field == UCAL_AM_PM) ++ret_tab[j][i]; // ampm + 1
+        else if (units_field == UCAL_ERA)   ++ret_tab[j][i]; // era + 1
+    }
+}
+
+
+/** Week number as in Calendar::weekNumber
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static inline int32_t stri__grego_week_number(
+    int32_t desired_day, int32_t day_of_period, int32_t day_of_week,
+    int32_t first_dow, int32_t min_days
+) {
+    int32_t period_start_dow = (day_of_week - first_dow - day_of_period + 1)%7;
+    if (period_start_dow < 0) period_start_dow += 7;
+    int32_t week = (desired_day + period_start_dow - 1)/7;
+    if ((7 - period_start_dow) >= min_days) ++week;
+    return week;
+}
+
+
+/** Get values of date-time fields natively, see stri_datetime_fields;
+ *  the results are the same as in ICU's GregorianCalendar
+ *  (Calendar::computeFields, Calendar::computeWeekFields)
+ *
+ * Thread-safe.
+ *
+ * @param t milliseconds since the UNIX epoch
+ * @param offset time zone offset at t
+ * @param first_dow first day of the week (UCAL_SUNDAY etc.)
+ * @param min_days minimal number of days in the first week
+ * @param ret_tab STRI__FIELDS_NUM arrays to store the results in
+ * @param i index
+ * @return false if the date is out of the supported range
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__datetime_fields_grego(
+    double t, int32_t offset, int32_t first_dow, int32_t min_days,
+    int** ret_tab, R_xlen_t i
+) {
+    double local = t + offset;
+    double days = floor(local/STRI__GREGO_MILLIS_PER_DAY);
+    int32_t millis = (int32_t)(floor(local) - days*STRI__GREGO_MILLIS_PER_DAY);
+
+    int32_t y, m, d;
+    stri__grego_civil_from_days((int32_t)days, y, m, d);
+    if (y < STRI__GREGO_MIN_YEAR || y > STRI__GREGO_MAX_YEAR) return false;
+
+    int32_t doy = (int32_t)days - stri__grego_days_from_civil(y, 1, 1) + 1;
+    int32_t dow = ((((int32_t)days)%7 + 7 + 4)%7) + 1;  // 1970-01-01 was a Thursday
+    int32_t hour = millis/3600000;
+
+    int32_t rel_dow = (dow + 7 - first_dow)%7;
+    int32_t rel_dow_jan1 = (dow - doy + 7001 - first_dow)%7;
+    int32_t woy = (doy - 1 + rel_dow_jan1)/7;
+    if ((7 - rel_dow_jan1) >= min_days) ++woy;
+    if (woy == 0) {
+        // the last week of the previous year
+        int32_t prev_doy = doy + (stri__grego_is_leap(y-1) ? 366 : 365);
+        woy = stri__grego_week_number(prev_doy, prev_doy, dow, first_dow, min_days);
+    }
+    else {
+        int32_t last_doy = stri__grego_is_leap(y) ? 366 : 365;
+        if (doy >= last_doy - 5) {
+            // maybe the first week of the next year
+            int32_t last_rel_dow = (rel_dow + last_doy - doy)%7;
+            if (last_rel_dow < 0) last_rel_dow += 7;
+            if ((6 - last_rel_dow) >= min_days && (doy + 7 - rel_dow) > last_doy)
+                woy = 1;
+        }
+    }
+
+    ret_tab[0][i]  = y;
+    ret_tab[1][i]  = m;
+    ret_tab[2][i]  = d;
+    ret_tab[3][i]  = hour;
+    ret_tab[4][i]  = (millis/60000)%60;
+    ret_tab[5][i]  = (millis/1000)%60;
+    ret_tab[6][i]  = millis%1000;
+    ret_tab[7][i]  = woy;
+    ret_tab[8][i]  = stri__grego_week_number(d, d, dow, first_dow, min_days);
+    ret_tab[9][i]  = doy;
+    ret_tab[10][i] = dow;
+    ret_tab[11][i] = hour%12;
+    ret_tab[12][i] = hour/12 + 1;
+    ret_tab[13][i] = 2;  // AD (+1)
+    return true;
+}
+
+
 /**
  * Get values of date-time fields
  *
@@ -234,6 +604,10 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-07)
  *     #476: Warn when falling back to the root locale, make C==en_US_POSIX
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     Gregorian calendar: native arithmetic with tabulated time zone
+ *     offsets, multithreaded; ICU is used for other calendars
  */
 SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale)
 {
@@ -255,86 +629,72 @@ SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale)
 
     UErrorCode status = U_ZERO_ERROR;
     SEXP ret;
-#define STRI__FIELDS_NUM 14
     STRI__PROTECT(ret = Rf_allocVector(VECSXP, STRI__FIELDS_NUM));
-    for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
+    int* ret_tab[STRI__FIELDS_NUM];
+    for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
         SET_VECTOR_ELT(ret, j, Rf_allocVector(INTSXP, vectorize_length));
+        ret_tab[j] = INTEGER(VECTOR_ELT(ret, j));
+    }
 
-    for (R_len_t i=0; i<vectorize_length; ++i) {
-        if (time_cont.isNA(i)) {
-            for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
-                INTEGER(VECTOR_ELT(ret, j))[i] = NA_INTEGER;
-            continue;
+    // the Gregorian calendar is dealt with natively
+    bool grego = (strcmp(cal->getType(), "gregorian") == 0);
+    StriZoneOffsetTable offsets;
+    if (grego) {
+        double t_min = STRI__GREGO_MAX_TIME, t_max = STRI__GREGO_MIN_TIME;
+        for (R_len_t i=0; i<vectorize_length; ++i) {
+            if (time_cont.isNA(i)) continue;
+            double t = time_cont.get(i)*1000.0;
+            if (t >= STRI__GREGO_MIN_TIME && t < t_min) t_min = t;
+            if (t <= STRI__GREGO_MAX_TIME && t > t_max) t_max = t;
         }
+        grego = offsets.prepare(&cal->getTimeZone(), t_min, t_max);
+    }
 
-        status = U_ZERO_ERROR;
-        cal->setTime((UDate)(time_cont.get(i)*1000.0), status);
+    int nworkers = 1;
+    std::vector< std::vector<R_len_t> > deferred(1);  // to be dealt with by ICU
+    if (grego) {
+        int32_t first_dow = (int32_t)cal->getFirstDayOfWeek(status);
         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        int32_t min_days = (int32_t)cal->getMinimalDaysInFirstWeek();
 
-        for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
-            UCalendarDateFields units_field;
-            switch (j) {
-            case 0:
-                units_field = UCAL_EXTENDED_YEAR;
-                break;
-            case 1:
-                units_field = UCAL_MONTH;
-                break;
-            case 2:
-                units_field = UCAL_DAY_OF_MONTH;
-                break;
-            case 3:
-                units_field = UCAL_HOUR_OF_DAY;
-                break;
-            case 4:
-                units_field = UCAL_MINUTE;
-                break;
-            case 5:
-                units_field = UCAL_SECOND;
-                break;
-            case 6:
-                units_field = UCAL_MILLISECOND;
-                break;
-            case 7:
-                units_field = UCAL_WEEK_OF_YEAR;
-                break;
-            case 8:
-                units_field = UCAL_WEEK_OF_MONTH;
-                break;
-            case 9:
-                units_field = UCAL_DAY_OF_YEAR;
-                break;
-            case 10:
-                units_field = UCAL_DAY_OF_WEEK;
-                break;
-            case 11:
-                units_field = UCAL_HOUR;
-                break;
-            case 12:
-                units_field = UCAL_AM_PM;
-                break;
-            case 13:
-                units_field = UCAL_ERA;
-                break;
-            default:
-                throw StriException(MSG__INCORRECT_MATCH_OPTION, "units");
-            }
-            //UCAL_IS_LEAP_MONTH
-            //UCAL_MILLISECONDS_IN_DAY -> SecondsInDay
+        nworkers = StriParallel::getNumWorkers(vectorize_length);
+        deferred.resize(nworkers);
+        StriParallel::run(vectorize_length, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int worker) {
+                for (R_xlen_t i=from; i<to; ++i) {
+                    if (time_cont.isNA(i)) {
+                        for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
+                            ret_tab[j][i] = NA_INTEGER;
+                        continue;
+                    }
 
-            // UCAL_AM_PM -> "AM" or "PM" (localized? or factor?+index in stri_datetime_symbols) add arg use_symbols????
-            // UCAL_DAY_OF_WEEK -> (localized? or factor?) SUNDAY, MONDAY
-            // UCAL_DAY_OF_YEAR '
+                    double t = time_cont.get(i)*1000.0;
+                    if (!offsets.covers(t) || !stri__datetime_fields_grego(t,
+                            offsets.getOffset(t), first_dow, min_days, ret_tab, i))
+                        deferred[worker].push_back((R_len_t)i);
+                }
+            });
+    }
+    else {
+        deferred[0].reserve(vectorize_length);
+        for (R_len_t i=0; i<vectorize_length; ++i)
+            deferred[0].push_back(i);
+    }
 
-            // isWekend
+    for (int w=0; w<nworkers; ++w) {
+        for (size_t k=0; k<deferred[w].size(); ++k) {
+            R_len_t i = deferred[w][k];
+            if (time_cont.isNA(i)) {
+                for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
+                    ret_tab[j][i] = NA_INTEGER;
+                continue;
+            }
 
             status = U_ZERO_ERROR;
-            INTEGER(VECTOR_ELT(ret, j))[i] = cal->get(units_field, status);
+            cal->setTime((UDate)(time_cont.get(i)*1000.0), status);
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
-            if (units_field == UCAL_MONTH)      ++INTEGER(VECTOR_ELT(ret, j))[i]; // month + 1
-            else if (units_field == UCAL_AM_PM) ++INTEGER(VECTOR_ELT(ret, j))[i]; // ampm + 1
-            else if (units_field == UCAL_ERA)   ++INTEGER(VECTOR_ELT(ret, j))[i]; // era + 1
+            stri__datetime_fields_icu(cal, ret_tab, i);
         }
     }
 
@@ -364,6 +724,40 @@ SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale)
 }
 
 
+/** Create a date-time object in the Gregorian calendar; gives the same
+ *  results as ICU (lenient or not) for valid field values
+ *
+ * Thread-safe.
+ *
+ * @return false if ICU should be used instead
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__datetime_create_grego(
+    const StriZoneOffsetTable& offsets, int32_t year, int32_t month,
+    int32_t day, int32_t hour, int32_t minute, double second, double& result
+) {
+    if (year < STRI__GREGO_MIN_YEAR || year > STRI__GREGO_MAX_YEAR ||
+            month < 1 || month > 12 || day < 1 ||
+            day > stri__grego_days_in_month(year, month) ||
+            hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
+            !(second >= 0.0 && second < 60.0))
+        return false;
+
+    int32_t sec = (int32_t)floor(second);
+    int32_t millis = (int32_t)fround((second-floor(second))*1000.0, 0);
+    if (millis > 999) return false;  // ICU: carry if lenient, error otherwise
+
+    double local = stri__grego_days_from_civil(year, month, day)*STRI__GREGO_MILLIS_PER_DAY +
+        (double)(((hour*60 + minute)*60 + sec)*1000 + millis);
+
+    int32_t offset;
+    if (!offsets.getOffsetFromLocal(local, offset)) return false;
+    result = local - offset;
+    return true;
+}
+
+
 /**
  * Create a date-time object
  *
@@ -386,6 +780,10 @@ SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale)
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-07)
  *     #476: Warn when falling back to the root locale, make C==en_US_POSIX
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     Gregorian calendar: native arithmetic with tabulated time zone
+ *     offsets, multithreaded; ICU is used for other calendars
  */
 SEXP stri_datetime_create(
     SEXP year, SEXP month, SEXP day, SEXP hour,
@@ -427,7 +825,52 @@ SEXP stri_datetime_create(
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(REALSXP, vectorize_length));
     double* ret_val = REAL(ret);
-    for (R_len_t i=0; i<vectorize_length; ++i) {
+
+    // the Gregorian calendar is dealt with natively; the offsets are
+    // tabulated for the range of years that we need
+    bool grego = (strcmp(cal->getType(), "gregorian") == 0);
+    StriZoneOffsetTable offsets;
+    if (grego) {
+        int32_t y_min = STRI__GREGO_MAX_YEAR, y_max = STRI__GREGO_MIN_YEAR;
+        for (R_len_t i=0; i<vectorize_length; ++i) {
+            if (year_cont.isNA(i)) continue;
+            int32_t y = year_cont.get(i);
+            if (y >= STRI__GREGO_MIN_YEAR && y < y_min) y_min = y;
+            if (y <= STRI__GREGO_MAX_YEAR && y > y_max) y_max = y;
+        }
+        offsets.prepare(&cal->getTimeZone(),  // covers nothing on failure
+            (stri__grego_days_from_civil(y_min, 1, 1)-3)*STRI__GREGO_MILLIS_PER_DAY,
+            (stri__grego_days_from_civil(y_max+1, 1, 1)+3)*STRI__GREGO_MILLIS_PER_DAY);
+    }
+
+    int nworkers = 1;
+    std::vector< std::vector<R_len_t> > deferred(1);  // to be dealt with by ICU
+    if (grego) {
+        nworkers = StriParallel::getNumWorkers(vectorize_length);
+        deferred.resize(nworkers);
+        StriParallel::run(vectorize_length, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int worker) {
+                for (R_xlen_t i=from; i<to; ++i) {
+                    if (year_cont.isNA(i) || month_cont.isNA(i)  || day_cont.isNA(i) ||
+                            hour_cont.isNA(i) || minute_cont.isNA(i) || second_cont.isNA(i))
+                        ret_val[i] = NA_REAL;
+                    else if (stri__datetime_create_grego(offsets, year_cont.get(i),
+                            month_cont.get(i), day_cont.get(i), hour_cont.get(i),
+                            minute_cont.get(i), second_cont.get(i), ret_val[i]))
+                        ret_val[i] /= 1000.0;
+                    else
+                        deferred[worker].push_back((R_len_t)i);
+                }
+            });
+    }
+    else {
+        deferred[0].reserve(vectorize_length);
+        for (R_len_t i=0; i<vectorize_length; ++i)
+            deferred[0].push_back(i);
+    }
+
+    for (int w=0; w<nworkers; ++w) for (size_t k=0; k<deferred[w].size(); ++k) {
+        R_len_t i = deferred[w][k];
         if (year_cont.isNA(i) || month_cont.isNA(i)  || day_cont.isNA(i) ||
                 hour_cont.isNA(i) || minute_cont.isNA(i) || second_cont.isNA(i)) {
             ret_val[i] = NA_REAL;
@@ -472,6 +915,263 @@ SEXP stri_datetime_create(
 }
 
 
+/** Compare the native Gregorian arithmetic against ICU's Calendar
+ *  for a single time zone [for testing only]
+ *
+ * The grid covers the times around the zone's transitions (most of which
+ * are deferred to ICU by the native engine, which is checked as well)
+ * and the ends of months in various years, all the units, a range of
+ * values, and both lenient and non-lenient calendars.  Date-time fields
+ * are compared for all the first days of the week and minimal numbers
+ * of days in the first week of a year.
+ *
+ * @param tz time zone
+ * @param mismatches [out] descriptions of the differing results
+ * @return number of cases resolved natively (and hence compared)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static double stri__test_datetime_grego_tz(
+    const TimeZone& tz, std::vector<std::string>& mismatches
+) {
+    UErrorCode status = U_ZERO_ERROR;
+    GregorianCalendar cal(tz, status);
+    if (U_FAILURE(status)) throw StriException(status);
+
+    StriZoneOffsetTable offsets;
+    offsets.prepare(&tz,
+        STRI__GREGO_MIN_TIME - 3.0*STRI__GREGO_MILLIS_PER_DAY,
+        STRI__GREGO_MAX_TIME + 3.0*STRI__GREGO_MILLIS_PER_DAY);
+
+    std::string tz_id;
+    UnicodeString tz_id_icu;
+    tz.getID(tz_id_icu).toUTF8String(tz_id);
+
+    const double hour = 3600000.0, day = STRI__GREGO_MILLIS_PER_DAY;
+    std::vector<double> times;
+
+    // times around some of the transitions (at most 400 of them)
+    const BasicTimeZone* btz = dynamic_cast<const BasicTimeZone*>(&tz);
+    if (btz) {
+        std::vector<double> tr_times;
+        TimeZoneTransition tr;
+        double cur = stri__grego_days_from_civil(1900, 1, 1)*day;
+        double end = stri__grego_days_from_civil(2100, 1, 1)*day;
+        while (btz->getNextTransition(cur, false, tr) && tr.getTime() < end) {
+            cur = tr.getTime();
+            tr_times.push_back(cur);
+        }
+        size_t step = tr_times.size()/400+1;
+        const double shifts[] = {-2*day-hour, -day, -hour, -1.0, 0.0, 1.0,
+            hour, day, 2*day+hour, 3*day};
+        for (size_t k=0; k<tr_times.size(); k+=step)
+            for (size_t j=0; j<sizeof(shifts)/sizeof(shifts[0]); ++j)
+                times.push_back(tr_times[k]+shifts[j]);
+    }
+
+    // ends of months, leap years, and the boundaries of the native range (UTC)
+    const int32_t years[] = {STRI__GREGO_MIN_YEAR, STRI__GREGO_MIN_YEAR+1,
+        1899, 1900, 1970, 1999, 2000, 2024, 2038, 2100, 2400,
+        STRI__GREGO_MAX_YEAR-1, STRI__GREGO_MAX_YEAR};
+    const int32_t mdays[] = {1, 15, 28, 29, 30, 31};
+    const double millis[] = {0.0, 1.0, 12*hour+1234.0, day-1.0};
+    for (size_t iy=0; iy<sizeof(years)/sizeof(years[0]); ++iy)
+        for (int32_t m=1; m<=12; ++m)
+            for (size_t id=0; id<sizeof(mdays)/sizeof(mdays[0]); ++id) {
+                if (mdays[id] > stri__grego_days_in_month(years[iy], m)) continue;
+                for (size_t im=0; im<sizeof(millis)/sizeof(millis[0]); ++im)
+                    times.push_back(stri__grego_days_from_civil(years[iy], m, mdays[id])*day
+                        + millis[im]);
+            }
+
+    double checked = 0;
+    char buf[256];
+
+    // stri_datetime_add
+    const UCalendarDateFields fields[] = {UCAL_YEAR, UCAL_MONTH,
+        UCAL_WEEK_OF_YEAR, UCAL_DAY_OF_MONTH, UCAL_HOUR_OF_DAY, UCAL_MINUTE,
+        UCAL_SECOND, UCAL_MILLISECOND};
+    const int32_t amounts[] = {-100000, -400, -25, -13, -12, -1, 0, 1, 2,
+        11, 12, 13, 25, 400, 100000};
+    cal.setLenient(true);
+    for (size_t i=0; i<times.size(); ++i) {
+        for (int units_cur=0; units_cur<8; ++units_cur) {
+            for (size_t ia=0; ia<sizeof(amounts)/sizeof(amounts[0]); ++ia) {
+                double res_native;
+                if (!stri__datetime_add_grego(offsets, times[i], amounts[ia],
+                        units_cur, res_native))
+                    continue;
+
+                ++checked;
+                status = U_ZERO_ERROR;
+                cal.setTime((UDate)times[i], status);
+                cal.add(fields[units_cur], amounts[ia], status);
+                double res_icu = (double)cal.getTime(status);
+                if (U_FAILURE(status) || res_icu != res_native) {
+                    snprintf(buf, sizeof(buf),
+                        "add: tz=%s time=%.0f units=%d value=%d native=%.0f ICU=%.0f",
+                        tz_id.c_str(), times[i], units_cur, amounts[ia], res_native,
+                        U_FAILURE(status)?NA_REAL:res_icu);
+                    mismatches.push_back(buf);
+                }
+            }
+        }
+    }
+
+    // stri_datetime_create: the local times corresponding to the above
+    const double seconds_frac[] = {0.0, 0.5, 0.999, 0.9996};
+    for (int lenient=0; lenient<=1; ++lenient) {
+        cal.setLenient(lenient);
+        for (size_t i=0; i<times.size(); ++i) {
+            if (!offsets.covers(times[i])) continue;
+            double local = times[i] + offsets.getOffset(times[i]);
+            double days = floor(local/day);
+            int32_t y, m, d;
+            stri__grego_civil_from_days((int32_t)days, y, m, d);
+            int32_t ms = (int32_t)(local - days*day);
+            int32_t h = ms/3600000, mi = (ms/60000)%60, s = (ms/1000)%60;
+
+            for (size_t is=0; is<sizeof(seconds_frac)/sizeof(seconds_frac[0]); ++is) {
+                double sec = s + seconds_frac[is];
+                double res_native;
+                if (!stri__datetime_create_grego(offsets, y, m, d, h, mi, sec, res_native))
+                    continue;
+
+                ++checked;
+                cal.clear();
+                cal.set(UCAL_EXTENDED_YEAR, y);
+                cal.set(UCAL_MONTH, m-1);
+                cal.set(UCAL_DATE, d);
+                cal.set(UCAL_HOUR_OF_DAY, h);
+                cal.set(UCAL_MINUTE, mi);
+                cal.set(UCAL_SECOND, (int)floor(sec));
+                cal.set(UCAL_MILLISECOND, (int)fround((sec-floor(sec))*1000.0, 0));
+                status = U_ZERO_ERROR;
+                double res_icu = (double)cal.getTime(status);
+                if (U_FAILURE(status) || res_icu != res_native) {
+                    snprintf(buf, sizeof(buf),
+                        "create: tz=%s lenient=%d %04d-%02d-%02d %02d:%02d:%06.3f native=%.0f ICU=%.0f",
+                        tz_id.c_str(), lenient, y, m, d, h, mi, sec, res_native,
+                        U_FAILURE(status)?NA_REAL:res_icu);
+                    mismatches.push_back(buf);
+                }
+            }
+        }
+    }
+
+    // stri_datetime_fields: all the above times with the week settings
+    // of, e.g., en_US, de_DE, and ar_EG, and the days around the turns
+    // of the years (all the 14 kinds of years) with all the possible settings
+    std::vector<double> times_ny;
+    for (int32_t y=2000; y<=2028; ++y) {
+        double jan1 = stri__grego_days_from_civil(y, 1, 1)*day;
+        double jan1_offset = offsets.covers(jan1)?offsets.getOffset(jan1):0.0;
+        for (int32_t d=-10; d<=10; ++d)
+            for (size_t im=0; im<sizeof(millis)/sizeof(millis[0]); im+=3)
+                times_ny.push_back(jan1 + d*day - jan1_offset + millis[im]);
+    }
+
+    const int32_t week_settings[][2] = {
+        {UCAL_SUNDAY, 1}, {UCAL_MONDAY, 4}, {UCAL_SATURDAY, 1}};
+    int32_t fields_native[STRI__FIELDS_NUM], fields_icu[STRI__FIELDS_NUM];
+    int* tab_native[STRI__FIELDS_NUM];
+    int* tab_icu[STRI__FIELDS_NUM];
+    for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
+        tab_native[j] = fields_native+j;
+        tab_icu[j] = fields_icu+j;
+    }
+    for (int32_t first_dow=UCAL_SUNDAY; first_dow<=UCAL_SATURDAY; ++first_dow) {
+        for (int32_t min_days=1; min_days<=7; ++min_days) {
+            bool common = false;
+            for (size_t k=0; k<sizeof(week_settings)/sizeof(week_settings[0]); ++k)
+                common |= (week_settings[k][0] == first_dow && week_settings[k][1] == min_days);
+
+            cal.setFirstDayOfWeek((UCalendarDaysOfWeek)first_dow);
+            cal.setMinimalDaysInFirstWeek((uint8_t)min_days);
+            for (int which=common?0:1; which<2; ++which) {
+                const std::vector<double>& cur_times = (which == 0)?times:times_ny;
+                for (size_t i=0; i<cur_times.size(); ++i) {
+                    double t = cur_times[i];
+                    if (!offsets.covers(t) || !stri__datetime_fields_grego(t,
+                            offsets.getOffset(t), first_dow, min_days, tab_native, 0))
+                        continue;
+
+                    ++checked;
+                    status = U_ZERO_ERROR;
+                    cal.setTime((UDate)t, status);
+                    if (U_FAILURE(status)) throw StriException(status);
+                    stri__datetime_fields_icu(&cal, tab_icu, 0);
+                    for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
+                        if (fields_native[j] == fields_icu[j]) continue;
+                        snprintf(buf, sizeof(buf),
+                            "fields: tz=%s time=%.0f first_dow=%d min_days=%d field=%d native=%d ICU=%d",
+                            tz_id.c_str(), t, first_dow, min_days, j,
+                            fields_native[j], fields_icu[j]);
+                        mismatches.push_back(buf);
+                    }
+                }
+            }
+        }
+    }
+
+    return checked;
+}
+
+
+/** Differential test of the native Gregorian calendar arithmetic
+ *  (see stri_datetime_add, stri_datetime_create, stri_datetime_fields)
+ *  against ICU
+ *  [for testing only]
+ *
+ * @param tz character vector of time zone identifiers
+ * @return list with the number of cases compared and a character vector
+ *    describing the mismatches (empty if all is well)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_test_datetime_grego(SEXP tz)
+{
+    PROTECT(tz = stri__prepare_arg_string(tz, "tz"));
+
+    STRI__ERROR_HANDLER_BEGIN(1)
+    R_len_t tz_n = LENGTH(tz);
+    std::vector<std::string> mismatches;
+    double checked = 0;
+    for (R_len_t i=0; i<tz_n; ++i) {
+        if (STRING_ELT(tz, i) == NA_STRING)
+            throw StriException(MSG__ARG_EXPECTED_NOT_NA, "tz");
+        TimeZone* tz_val = TimeZone::createTimeZone(
+            UnicodeString::fromUTF8(CHAR(STRING_ELT(tz, i))));
+        if (*tz_val == TimeZone::getUnknown()) {
+            delete tz_val;
+            throw StriException(MSG__INCORRECT_NAMED_ARG, "tz");
+        }
+        try {
+            checked += stri__test_datetime_grego_tz(*tz_val, mismatches);
+        }
+        catch (...) {
+            delete tz_val;
+            throw;
+        }
+        delete tz_val;
+    }
+
+    SEXP ret, ret_mismatches;
+    STRI__PROTECT(ret = Rf_allocVector(VECSXP, 2));
+    SET_VECTOR_ELT(ret, 0, Rf_ScalarReal(checked));
+    STRI__PROTECT(ret_mismatches = Rf_allocVector(STRSXP, mismatches.size()));
+    for (size_t k=0; k<mismatches.size(); ++k)
+        SET_STRING_ELT(ret_mismatches, k,
+            Rf_mkCharLenCE(mismatches[k].c_str(), (int)mismatches[k].size(), CE_UTF8));
+    SET_VECTOR_ELT(ret, 1, ret_mismatches);
+    Rf_setAttrib(ret, R_NamesSymbol,
+        stri__make_character_vector_char_ptr(2, "checked", "mismatches"));
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END({/* nothing special */})
+}
+
+
 // /**
 //  * @param x list
 //  * @return POSIXct
@@ -31,13 +31,16 @@
 
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
 #include "stri_container_utf8.h"
 #include "stri_container_double.h"
 #include "stri_container_integer.h"
+#include "stri_time_cache.h"
+#include "stri_time_iso.h"
 #include <unicode/calendar.h>
 #include <unicode/gregocal.h>
 #include <unicode/smpdtfmt.h>
+#include <string>
+#include <vector>
 
 
 /**
@@ -45,11 +48,19 @@
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-05-24)
  *    refactor from stri_datetime_parse
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    clone the formatters from the cache
  */
 DateFormat* stri__get_date_format(
     const char* format_val, const char* locale_val, UErrorCode status
 ) {
-    DateFormat* fmt = NULL;
+    std::string fmt_key(format_val);
+    fmt_key.push_back('\0');  // cannot occur in either string
+    fmt_key.append((locale_val)?locale_val:uloc_getDefault());
+
+    DateFormat* fmt = stri__date_format_cache().get(fmt_key);
+    if (fmt) return fmt;
 
     // "format" may be one of:
     const char* format_opts[] = {
@@ -131,6 +142,9 @@ DateFormat* stri__get_date_format(
         );
     }
 
+    if (fmt && U_SUCCESS(status))
+        stri__date_format_cache().put(fmt_key, fmt);
+
     return fmt;
 }
 
@@ -148,6 +162,7 @@ DateFormat* stri__get_date_format(
  * @version 0.5-1 (Marek Gagolewski, 2015-01-05)
  * @version 0.5-1 (Marek Gagolewski, 2015-02-22) use tz
  * @version 1.6.3 (Marek Gagolewski, 2021-05-24) #434: vectorise wrt format
+ * @version 1.8.8 (2026-10-19) native fast path for ISO 8601-like formats
  */
 SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
 {
@@ -164,6 +179,7 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
     TimeZone* tz_val = stri__prepare_arg_timezone(tz, "tz", true/*allowdefault*/);
     Calendar* cal = NULL;
     DateFormat* fmt = NULL;
+    StriDateTimeISO* iso = NULL;
 
     STRI__ERROR_HANDLER_BEGIN(2)
     StriContainerDouble time_cont(time, vectorize_length);
@@ -174,6 +190,10 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
     cal->adoptTimeZone(tz_val);
     tz_val = NULL; /* The Calendar takes ownership of the TimeZone. */
 
+    iso = new StriDateTimeISO(cal, locale_val);
+    bool iso_ok = false;
+    std::string iso_buf;
+
     UErrorCode status = U_ZERO_ERROR;
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
@@ -198,6 +218,18 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
                 fmt = NULL;
             }
 
+            iso_ok = iso->setPattern(format_cur->c_str());
+        }
+
+        if (iso_ok) {  // ISO 8601-like formats are dealt with natively
+            iso_buf.clear();
+            if (iso->format((UDate)(time_cont.get(i)*1000.0), iso_buf)) {
+                SET_STRING_ELT(ret, i, Rf_mkCharLenCE(iso_buf.data(), (int)iso_buf.length(), (cetype_t)CE_UTF8));
+                continue;
+            }
+        }
+
+        if (!fmt) {
             status = U_ZERO_ERROR;
             fmt = stri__get_date_format(format_cur->c_str(), locale_val, status);
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
@@ -224,6 +256,10 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
         delete fmt;
         fmt = NULL;
     }
+    if (iso) {
+        delete iso;
+        iso = NULL;
+    }
     if (cal) {
         delete cal;
         cal = NULL;
@@ -239,6 +275,10 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
             delete fmt;
             fmt = NULL;
         }
+        if (iso) {
+            delete iso;
+            iso = NULL;
+        }
         if (cal) {
             delete cal;
             cal = NULL;
@@ -247,6 +287,47 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
 }
 
 
+/**
+ * Parse a date-time with ICU
+ *
+ * @param fmt date format
+ * @param cal calendar (its time zone may be replaced by the one
+ *    read from the input)
+ * @param now the default date (the time fields are reset)
+ * @param str string to parse
+ *
+ * @return seconds since the UNIX epoch or NA_REAL on error
+ *
+ * @version 1.8.8 (2026-10-19) refactor from stri_datetime_parse
+ */
+double stri__datetime_parse_icu(DateFormat* fmt, Calendar* cal, UDate now, const String8& str)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    cal->setTime(now, status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+    // weirdly, all the time fields must be reset
+    cal->clear(UCAL_MILLISECOND);
+    cal->clear(UCAL_SECOND);
+    cal->clear(UCAL_MINUTE);
+    cal->clear(UCAL_AM_PM);
+    cal->clear(UCAL_HOUR);
+    cal->clear(UCAL_HOUR_OF_DAY);
+    cal->clear(UCAL_MILLISECONDS_IN_DAY);
+
+    ParsePosition pos;
+    fmt->parse(UnicodeString::fromUTF8(StringPiece(str.c_str(), str.length())), *cal, pos);
+
+    if (pos.getErrorIndex() >= 0)
+        return NA_REAL;
+
+    status = U_ZERO_ERROR;
+    double ret = ((double)cal->getTime(status))/1000.0;
+    if (U_FAILURE(status)) return NA_REAL;
+    return ret;
+}
+
+
 /**
  * Parse date-time objects
  *
@@ -265,6 +346,7 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale)
  * @version 1.6.3 (Marek Gagolewski, 2021-05-24) #434: vectorise wrt format
  * @version 1.6.3 (Marek Gagolewski, 2021-06-07) empty retval should have a class too
  * @version 1.8.1 (Marek Gagolewski, 2023-11-08) #469: default time is midnight today
+ * @version 1.8.8 (2026-10-19) native fast path for ISO 8601-like formats
  */
 SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP locale)
 {
@@ -289,8 +371,9 @@ SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP loca
     TimeZone* tz_val = stri__prepare_arg_timezone(tz, "tz", true/*allowdefault*/);
     Calendar* cal = NULL;
     DateFormat* fmt = NULL;
+    StriDateTimeISO* iso = NULL;
     STRI__ERROR_HANDLER_BEGIN(3)
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerUTF8 format_cont(format, vectorize_length);
 
     cal = stri__get_calendar(locale_val);
@@ -300,6 +383,9 @@ SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP loca
 
     cal->setLenient(lenient_val);
 
+    iso = new StriDateTimeISO(cal, locale_val);
+    bool iso_ok = false;
+
     UDate now = cal->getNow();
 
     UErrorCode status = U_ZERO_ERROR;
@@ -326,34 +412,29 @@ SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP loca
                 fmt = NULL;
             }
 
-            status = U_ZERO_ERROR;
-            fmt = stri__get_date_format(format_cur->c_str(), locale_val, status);
-            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            // ICU's parser may replace the calendar's time zone with
+            // the one read from the input, which affects the elements
+            // that follow, possibly parsed with other formats;
+            // hence, the native parser is used only if there is one format
+            iso_ok = (LENGTH(format) == 1 && iso->setPattern(format_cur->c_str()));
         }
 
-        status = U_ZERO_ERROR;
-        cal->setTime(now, status);
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-        // weirdly, all the time fields must be reset
-        cal->clear(UCAL_MILLISECOND);
-        cal->clear(UCAL_SECOND);
-        cal->clear(UCAL_MINUTE);
-        cal->clear(UCAL_AM_PM);
-        cal->clear(UCAL_HOUR);
-        cal->clear(UCAL_HOUR_OF_DAY);
-        cal->clear(UCAL_MILLISECONDS_IN_DAY);
-
-        ParsePosition pos;
-        fmt->parse(str_cont.get(i), *cal, pos);
+        const String8& str_cur = str_cont.get(i);
+        if (iso_ok) {  // ISO 8601-like formats are dealt with natively
+            UDate t;
+            if (iso->parse(str_cur.c_str(), str_cur.length(), t)) {
+                REAL(ret)[i] = ((double)t)/1000.0;
+                continue;
+            }
+        }
 
-        if (pos.getErrorIndex() >= 0)
-            REAL(ret)[i] = NA_REAL;
-        else {
+        if (!fmt) {
             status = U_ZERO_ERROR;
-            REAL(ret)[i] = ((double)cal->getTime(status))/1000.0;
-            if (U_FAILURE(status)) REAL(ret)[i] = NA_REAL;
+            fmt = stri__get_date_format(format_cur->c_str(), locale_val, status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
+
+        REAL(ret)[i] = stri__datetime_parse_icu(fmt, cal, now, str_cur);
     }
 
 
@@ -368,6 +449,10 @@ SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP loca
         delete fmt;
         fmt = NULL;
     }
+    if (iso) {
+        delete iso;
+        iso = NULL;
+    }
     if (cal) {
         delete cal;
         cal = NULL;
@@ -383,6 +468,10 @@ SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP loca
             delete fmt;
             fmt = NULL;
         }
+        if (iso) {
+            delete iso;
+            iso = NULL;
+        }
         if (cal) {
             delete cal;
             cal = NULL;
@@ -570,3 +659,170 @@ SEXP stri_datetime_fstr(SEXP x)
     return ret;
     STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
 }
+
+
+/** Differential test of the native ISO 8601 date-time engine
+ *  (see stri_datetime_format, stri_datetime_parse) against ICU
+ *  [for testing only]
+ *
+ * @param time POSIXct, to be formatted
+ * @param str character vector, to be parsed
+ * @param format single string, an ICU date-time format
+ * @param tz single string or NULL
+ * @param locale single string or NULL
+ *
+ * @return list with: whether the format is supported by the native engine;
+ *    the results of formatting and of strict and lenient parsing
+ *    done by ICU alone; logical vectors indicating which times were
+ *    formatted and which strings were parsed natively;
+ *    a character vector describing the mismatches (empty if all is well)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+SEXP stri_test_datetime_iso(SEXP time, SEXP str, SEXP format, SEXP tz, SEXP locale)
+{
+    const char* locale_val = stri__prepare_arg_locale(locale, "locale");
+    PROTECT(time = stri__prepare_arg_POSIXct(time, "time"));
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    PROTECT(format = stri__prepare_arg_string_1(format, "format"));
+    if (STRING_ELT(format, 0) == NA_STRING) {
+        UNPROTECT(3);
+        Rf_error(MSG__ARG_EXPECTED_NOT_NA, "format");
+    }
+
+    TimeZone* tz_val = stri__prepare_arg_timezone(tz, "tz", true/*allowdefault*/);
+    Calendar* cal = NULL;
+    DateFormat* fmt = NULL;
+    StriDateTimeISO* iso = NULL;
+
+    STRI__ERROR_HANDLER_BEGIN(3)
+    R_len_t time_n = LENGTH(time);
+    R_len_t str_n = LENGTH(str);
+    StriContainerDouble time_cont(time, time_n);
+    StriContainerUTF8 str_cont(str, str_n);
+    const char* format_val = CHAR(STRING_ELT(format, 0));
+
+    cal = stri__get_calendar(locale_val);
+    cal->adoptTimeZone(tz_val->clone());
+
+    UErrorCode status = U_ZERO_ERROR;
+    fmt = stri__get_date_format(format_val, locale_val, status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+    iso = new StriDateTimeISO(cal, locale_val);
+    bool supported = iso->setPattern(format_val);
+
+    std::vector<std::string> mismatches;
+    char buf[512];
+
+    SEXP ret, ret_format, ret_parse, ret_lenient, ret_native_format, ret_native_parse;
+    STRI__PROTECT(ret_format = Rf_allocVector(STRSXP, time_n));
+    STRI__PROTECT(ret_native_format = Rf_allocVector(LGLSXP, time_n));
+    for (R_len_t i = 0; i < time_n; ++i) {
+        LOGICAL(ret_native_format)[i] = FALSE;
+        if (time_cont.isNA(i)) {
+            SET_STRING_ELT(ret_format, i, NA_STRING);
+            continue;
+        }
+
+        UDate t = (UDate)(time_cont.get(i)*1000.0);
+        status = U_ZERO_ERROR;
+        cal->setTime(t, status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        FieldPosition pos;
+        UnicodeString out;
+        fmt->format(*cal, out, pos);
+        std::string s_icu;
+        out.toUTF8String(s_icu);
+        SET_STRING_ELT(ret_format, i, Rf_mkCharLenCE(s_icu.c_str(), (int)s_icu.length(), (cetype_t)CE_UTF8));
+
+        std::string s_native;
+        if (supported && iso->format(t, s_native)) {
+            LOGICAL(ret_native_format)[i] = TRUE;
+            if (s_native != s_icu) {
+                snprintf(buf, sizeof(buf), "format: time=%.3f native=%s ICU=%s",
+                    t, s_native.c_str(), s_icu.c_str());
+                mismatches.push_back(buf);
+            }
+        }
+    }
+
+    STRI__PROTECT(ret_parse = Rf_allocVector(REALSXP, str_n));
+    STRI__PROTECT(ret_lenient = Rf_allocVector(REALSXP, str_n));
+    STRI__PROTECT(ret_native_parse = Rf_allocVector(LGLSXP, str_n));
+    UDate now = cal->getNow();
+    for (R_len_t i = 0; i < str_n; ++i) {
+        LOGICAL(ret_native_parse)[i] = FALSE;
+        if (str_cont.isNA(i)) {
+            REAL(ret_parse)[i] = NA_REAL;
+            REAL(ret_lenient)[i] = NA_REAL;
+            continue;
+        }
+
+        const String8& str_cur = str_cont.get(i);
+        for (int lenient = 0; lenient <= 1; ++lenient) {
+            cal->setLenient(lenient != 0);
+            double t_icu = stri__datetime_parse_icu(fmt, cal, now, str_cur);
+            cal->setTimeZone(*tz_val);  // ICU might have changed it
+            REAL(lenient ? ret_lenient : ret_parse)[i] = t_icu;
+
+            UDate t;
+            if (supported && iso->parse(str_cur.c_str(), str_cur.length(), t)) {
+                LOGICAL(ret_native_parse)[i] = TRUE;
+                double t_native = ((double)t)/1000.0;
+                if (!(t_native == t_icu)) {  // also if ICU gives NA
+                    snprintf(buf, sizeof(buf), "parse: lenient=%d str=%s native=%.3f ICU=%.3f",
+                        lenient, str_cur.c_str(), t_native, t_icu);
+                    mismatches.push_back(buf);
+                }
+            }
+        }
+    }
+
+    SEXP ret_mismatches;
+    STRI__PROTECT(ret_mismatches = Rf_allocVector(STRSXP, mismatches.size()));
+    for (size_t k=0; k<mismatches.size(); ++k)
+        SET_STRING_ELT(ret_mismatches, k,
+            Rf_mkCharLenCE(mismatches[k].c_str(), (int)mismatches[k].size(), CE_UTF8));
+
+    STRI__PROTECT(ret = Rf_allocVector(VECSXP, 7));
+    SET_VECTOR_ELT(ret, 0, Rf_ScalarLogical(supported));
+    SET_VECTOR_ELT(ret, 1, ret_format);
+    SET_VECTOR_ELT(ret, 2, ret_parse);
+    SET_VECTOR_ELT(ret, 3, ret_lenient);
+    SET_VECTOR_ELT(ret, 4, ret_native_format);
+    SET_VECTOR_ELT(ret, 5, ret_native_parse);
+    SET_VECTOR_ELT(ret, 6, ret_mismatches);
+    Rf_setAttrib(ret, R_NamesSymbol,
+        stri__make_character_vector_char_ptr(7, "supported", "format", "parse",
+            "parse_lenient", "native_format", "native_parse", "mismatches"));
+
+    delete tz_val;
+    tz_val = NULL;
+    delete fmt;
+    fmt = NULL;
+    delete iso;
+    iso = NULL;
+    delete cal;
+    cal = NULL;
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END({
+        if (tz_val) {
+            delete tz_val;
+            tz_val = NULL;
+        }
+        if (fmt) {
+            delete fmt;
+            fmt = NULL;
+        }
+        if (iso) {
+            delete iso;
+            iso = NULL;
+        }
+        if (cal) {
+            delete cal;
+            cal = NULL;
+        }
+    })
+}
@@ -0,0 +1,118 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_time_gregorian.h"
+#include <unicode/tztrans.h>
+
+
+/* more transitions than this are not worth tabulating */
+#define STRI__GREGO_MAX_TRANSITIONS 100000
+
+
+/** Tabulate the offsets of a time zone in a given time range
+ *
+ * @param tz time zone
+ * @param from start of the range (milliseconds since the UNIX epoch)
+ * @param to end of the range (inclusive)
+ * @return false if the table could not be created (and covers() nothing)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriZoneOffsetTable::prepare(const TimeZone* tz, double from, double to)
+{
+    m_times.clear();
+    m_offsets.clear();
+    m_from = 1.0;
+    m_to = 0.0;  // empty range
+
+    if (!(from <= to)) return false;
+
+    const BasicTimeZone* btz = dynamic_cast<const BasicTimeZone*>(tz);
+    if (!btz) return false;
+
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t raw, dst;
+    tz->getOffset(from, false, raw, dst, status);
+    if (U_FAILURE(status)) return false;
+    m_offsets.push_back(raw+dst);
+
+    TimeZoneTransition tr;
+    double cur = from;
+    while (btz->getNextTransition(cur, false, tr) && tr.getTime() <= to) {
+        cur = tr.getTime();
+        tz->getOffset(cur, false, raw, dst, status);
+        if (U_FAILURE(status) || m_times.size() >= STRI__GREGO_MAX_TRANSITIONS) {
+            m_times.clear();
+            m_offsets.clear();
+            return false;
+        }
+        m_times.push_back(cur);
+        m_offsets.push_back(raw+dst);
+    }
+
+    m_from = from;
+    m_to = to;
+    return true;
+}
+
+
+/** The offset at a given local (wall) time
+ *
+ * Only succeeds if the local time is unambiguous, i.e., if it is
+ * far from any time zone transition (and from the ends of the table);
+ * otherwise, ICU should decide what to do with skipped or repeated
+ * wall times.
+ *
+ * @param local local time (milliseconds since 1970-01-01 00:00 local time)
+ * @param offset [out]
+ * @return whether the offset was determined
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriZoneOffsetTable::getOffsetFromLocal(double local, int32_t& offset) const
+{
+    if (!covers(local)) return false;
+    double t = local - m_offsets[findInterval(local)];  // a guess
+    if (!covers(t)) return false;
+
+    size_t k = findInterval(t);
+    t = local - m_offsets[k];
+    double from = (k > 0) ? m_times[k-1] : m_from;
+    double to = (k < m_times.size()) ? m_times[k] : m_to;
+    if (!(t >= from + STRI__GREGO_OFFSET_MARGIN && t < to - STRI__GREGO_OFFSET_MARGIN))
+        return false;
+
+    offset = m_offsets[k];
+    return true;
+}
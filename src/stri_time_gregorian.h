@@ -0,0 +1,153 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef __stri_time_gregorian_h
+#define __stri_time_gregorian_h
+
+#include "stri_stringi.h"
+#include <unicode/timezone.h>
+#include <unicode/basictz.h>
+#include <vector>
+
+
+/* the range of years for which the native Gregorian arithmetic is used;
+ * the Julian/Gregorian cutover (1582) is left to ICU */
+#define STRI__GREGO_MIN_YEAR 1600
+#define STRI__GREGO_MAX_YEAR 9999
+
+#define STRI__GREGO_MILLIS_PER_DAY 86400000.0
+
+/* time zone offsets are less than 24h, so they differ by less than 2 days */
+#define STRI__GREGO_OFFSET_MARGIN (2.0*STRI__GREGO_MILLIS_PER_DAY)
+
+
+/** Days since 1970-01-01 in the proleptic Gregorian calendar
+ *  (H. Hinnant's algorithm, valid for y >= 0)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+inline int32_t stri__grego_days_from_civil(int32_t y, int32_t m, int32_t d)
+{
+    y -= (m <= 2);
+    int32_t era = y/400;
+    int32_t yoe = y-era*400;
+    int32_t doy = (153*(m + (m > 2 ? -3 : 9)) + 2)/5 + d-1;
+    int32_t doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + doe - 719468;
+}
+
+
+/** The inverse of stri__grego_days_from_civil (valid for z >= -719468)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+inline void stri__grego_civil_from_days(
+    int32_t z, int32_t& y, int32_t& m, int32_t& d
+) {
+    z += 719468;
+    int32_t era = z/146097;
+    int32_t doe = z-era*146097;
+    int32_t yoe = (doe - doe/1460 + doe/36524 - doe/146096)/365;
+    int32_t doy = doe - (365*yoe + yoe/4 - yoe/100);
+    int32_t mp = (5*doy + 2)/153;
+    d = doy - (153*mp + 2)/5 + 1;
+    m = (mp < 10) ? mp+3 : mp-9;
+    y = yoe + era*400 + (m <= 2);
+}
+
+
+inline bool stri__grego_is_leap(int32_t y)
+{
+    return (y%4 == 0 && (y%100 != 0 || y%400 == 0));
+}
+
+
+inline int32_t stri__grego_days_in_month(int32_t y, int32_t m)
+{
+    static const int32_t dim[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (m == 2 && stri__grego_is_leap(y))
+        return 29;
+    return dim[m-1];
+}
+
+
+/**
+ * Time zone offsets (raw+DST) over a time range, stored as a sorted
+ * table of transition times searched with bisection;
+ * gives the same results as TimeZone::getOffset
+ *
+ * Once prepared, the table is read-only, and thus may be used
+ * from multiple threads.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriZoneOffsetTable {
+
+private:
+
+    std::vector<double> m_times;     ///< transitions within (m_from, m_to]
+    std::vector<int32_t> m_offsets;  ///< m_offsets[k] is valid in [m_times[k-1], m_times[k])
+    double m_from;
+    double m_to;
+
+    /** index of the first transition > t */
+    inline size_t findInterval(double t) const {
+        size_t a = 0, b = m_times.size();
+        while (a < b) {
+            size_t c = a+(b-a)/2;
+            if (m_times[c] <= t) a = c+1;
+            else b = c;
+        }
+        return a;
+    }
+
+public:
+
+    StriZoneOffsetTable() : m_from(1.0), m_to(0.0) { }
+
+    bool prepare(const TimeZone* tz, double from, double to);
+
+    /** is t within the prepared range? */
+    inline bool covers(double t) const {
+        return (t >= m_from && t <= m_to);
+    }
+
+    /** the offset at t (which must be covered) in milliseconds */
+    inline int32_t getOffset(double t) const {
+        return m_offsets[findInterval(t)];
+    }
+
+    bool getOffsetFromLocal(double local, int32_t& offset) const;
+};
+
+#endif
@@ -0,0 +1,481 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_time_iso.h"
+#include <unicode/numsys.h>
+#include <cmath>
+#include <cstring>
+
+
+#define STRI__ISO_LITERAL  0
+#define STRI__ISO_YEAR     1
+#define STRI__ISO_MONTH    2
+#define STRI__ISO_DAY      3
+#define STRI__ISO_HOUR     4
+#define STRI__ISO_MINUTE   5
+#define STRI__ISO_SECOND   6
+#define STRI__ISO_FRACTION 7
+#define STRI__ISO_OFFSET   8
+
+/* offset styles, see TimeZoneFormat::formatOffsetISO8601 */
+#define STRI__ISO_OFFSET_UTC      1  /* "Z" for zero offsets */
+#define STRI__ISO_OFFSET_EXTENDED 2  /* "+01:00" vs "+0100" */
+#define STRI__ISO_OFFSET_SHORT    4  /* minutes may be omitted, "+01" */
+#define STRI__ISO_OFFSET_SECONDS  8  /* seconds output if non-zero */
+
+/* the time zone offsets are tabulated this far from a given date-time */
+#define STRI__ISO_OFFSET_WINDOW (366.0*STRI__GREGO_MILLIS_PER_DAY)
+
+
+static inline void stri__iso_put_digits(std::string& out, int32_t val, int width)
+{
+    char buf[16];
+    for (int k = width-1; k >= 0; --k) {
+        buf[k] = (char)('0' + val%10);
+        val /= 10;
+    }
+    out.append(buf, width);
+}
+
+
+/** Reads exactly `width` ASCII digits */
+static inline bool stri__iso_get_digits(
+    const char* str, R_len_t n, R_len_t& j, int width, int32_t& val
+) {
+    if (j+width > n) return false;
+    val = 0;
+    for (int k = 0; k < width; ++k) {
+        char c = str[j+k];
+        if (c < '0' || c > '9') return false;
+        val = val*10 + (c-'0');
+    }
+    j += width;
+    return true;
+}
+
+
+/** Constructor
+ *
+ * @param cal calendar whose time zone is to be used (copied)
+ * @param locale locale used by the calendar and the date formatters
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriDateTimeISO::StriDateTimeISO(const Calendar* cal, const char* locale)
+    : m_enabled(false), m_pattern_ok(false), m_parse_ok(false),
+      m_tz(NULL)
+{
+    m_tz = cal->getTimeZone().clone();
+
+    UErrorCode status = U_ZERO_ERROR;
+    NumberingSystem* ns = NumberingSystem::createInstance(
+        Locale::createFromName(locale), status);
+    bool ascii_digits = (U_SUCCESS(status) && ns &&
+        !ns->isAlgorithmic() && ns->getRadix() == 10 &&
+        ns->getDescription() == UnicodeString("0123456789", -1, US_INV));
+    if (ns) delete ns;
+
+    m_enabled = (ascii_digits && strcmp(cal->getType(), "gregorian") == 0);
+}
+
+
+StriDateTimeISO::~StriDateTimeISO()
+{
+    if (m_tz) {
+        delete m_tz;
+        m_tz = NULL;
+    }
+}
+
+
+/** Check if a date-time pattern is supported and prepare it for use
+ *
+ * Supported are the year (uuuu or yyyy), month (MM), day (dd),
+ * hour (HH), minute (mm), second (ss), fractional second (S to SSSSSSSSS)
+ * and ISO 8601 offset (X to XXXXX, x to xxxxx, Z to ZZZ, ZZZZZ) fields,
+ * each used at most once, separated by simple literals
+ * (e.g., "-", ":", ".", " ", "'T'", "'Z'").
+ *
+ * @param pattern ICU date-time pattern
+ * @return whether format() and parse() may be called
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriDateTimeISO::setPattern(const char* pattern)
+{
+    m_items.clear();
+    m_pattern_ok = m_parse_ok = false;
+    if (!m_enabled) return false;
+
+    int seen = 0;
+    std::string lit;
+    R_len_t i = 0;
+    while (pattern[i]) {
+        char c = pattern[i];
+        if (c == '\'') {
+            // quoted literal; '' stands for a quote, which we do not support
+            i++;
+            if (!pattern[i] || pattern[i] == '\'') return false;
+            while (pattern[i] != '\'') {
+                if (!pattern[i]) return false;  // unterminated
+                lit.push_back(pattern[i++]);
+            }
+            i++;
+            continue;
+        }
+
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))) {
+            lit.push_back(c);
+            i++;
+            continue;
+        }
+
+        // a pattern field
+        int count = 0;
+        while (pattern[i] == c) {
+            count++;
+            i++;
+        }
+
+        Item item;
+        item.width = count;
+        switch (c) {
+            case 'u':
+            case 'y': item.type = STRI__ISO_YEAR;     if (count != 4) return false; break;
+            case 'M': item.type = STRI__ISO_MONTH;    if (count != 2) return false; break;
+            case 'd': item.type = STRI__ISO_DAY;      if (count != 2) return false; break;
+            case 'H': item.type = STRI__ISO_HOUR;     if (count != 2) return false; break;
+            case 'm': item.type = STRI__ISO_MINUTE;   if (count != 2) return false; break;
+            case 's': item.type = STRI__ISO_SECOND;   if (count != 2) return false; break;
+            case 'S': item.type = STRI__ISO_FRACTION; if (count > 9)  return false; break;
+
+            case 'X':
+            case 'x':
+                item.type = STRI__ISO_OFFSET;
+                if (count > 5) return false;
+                item.width = (c == 'X') ? STRI__ISO_OFFSET_UTC : 0;
+                if (count == 1) item.width |= STRI__ISO_OFFSET_SHORT;
+                if (count == 3 || count == 5) item.width |= STRI__ISO_OFFSET_EXTENDED;
+                if (count >= 4) item.width |= STRI__ISO_OFFSET_SECONDS;
+                break;
+
+            case 'Z':
+                item.type = STRI__ISO_OFFSET;
+                if (count < 4)
+                    item.width = STRI__ISO_OFFSET_SECONDS;
+                else if (count == 5)
+                    item.width = STRI__ISO_OFFSET_UTC|STRI__ISO_OFFSET_EXTENDED|STRI__ISO_OFFSET_SECONDS;
+                else
+                    return false;  // localised GMT format
+                break;
+
+            default:
+                return false;
+        }
+
+        if (seen & (1<<item.type)) return false;
+        seen |= (1<<item.type);
+
+        if (!lit.empty()) {
+            Item litem;
+            litem.type = STRI__ISO_LITERAL;
+            litem.width = 0;
+            litem.lit.swap(lit);
+            m_items.push_back(litem);
+            lit.clear();
+        }
+        m_items.push_back(item);
+    }
+
+    if (!lit.empty()) {
+        Item litem;
+        litem.type = STRI__ISO_LITERAL;
+        litem.width = 0;
+        litem.lit.swap(lit);
+        m_items.push_back(litem);
+    }
+
+    // literals must not be confused with the numeric fields
+    // nor with ICU's lenient whitespace handling
+    for (size_t k = 0; k < m_items.size(); ++k) {
+        if (m_items[k].type != STRI__ISO_LITERAL) continue;
+        const std::string& s = m_items[k].lit;
+        for (size_t l = 0; l < s.size(); ++l) {
+            if (!strchr("-/:.,_TZ ", s[l]) || s[l] == '\0') return false;
+            if (s[l] == ' ' && l > 0 && s[l-1] == ' ') return false;
+        }
+    }
+
+    m_pattern_ok = true;
+    m_parse_ok = (seen & (1<<STRI__ISO_YEAR)) && (seen & (1<<STRI__ISO_MONTH)) &&
+        (seen & (1<<STRI__ISO_DAY));
+    return true;
+}
+
+
+/** Tabulate the time zone offsets around a given time
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriDateTimeISO::prepareOffsets(double t)
+{
+    return m_offsets.prepare(m_tz,
+        t - STRI__ISO_OFFSET_WINDOW, t + STRI__ISO_OFFSET_WINDOW);
+}
+
+
+/** Time zone offset (raw+DST) at a given UTC time
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriDateTimeISO::getOffset(double t, int32_t& offset)
+{
+    if (!m_offsets.covers(t) && !prepareOffsets(t))
+        return false;
+    offset = m_offsets.getOffset(t);
+    return true;
+}
+
+
+/** Time zone offset at a given local (wall) time
+ *
+ * Only succeeds if the local time is unambiguous, i.e., if it is
+ * far from any time zone transition; otherwise, ICU will decide
+ * what to do with skipped or repeated wall times.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriDateTimeISO::getOffsetFromLocal(double local, int32_t& offset)
+{
+    // the ends of the table must be far from local,
+    // see StriZoneOffsetTable::getOffsetFromLocal
+    if (!(m_offsets.covers(local - 2.0*STRI__GREGO_OFFSET_MARGIN) &&
+            m_offsets.covers(local + 2.0*STRI__GREGO_OFFSET_MARGIN)) &&
+            !prepareOffsets(local))
+        return false;
+    return m_offsets.getOffsetFromLocal(local, offset);
+}
+
+
+/** Format a date-time
+ *
+ * @param t milliseconds since the UNIX epoch
+ * @param out [out] output string (appended to)
+ * @return false if ICU should be used instead
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriDateTimeISO::format(UDate t, std::string& out)
+{
+    if (!m_pattern_ok || !(t > -1.0e15 && t < 1.0e15)) return false;
+
+    int32_t offset;
+    if (!getOffset(t, offset)) return false;
+
+    // as in Calendar::computeFields
+    double local = t + offset;
+    double days = floor(local/STRI__GREGO_MILLIS_PER_DAY);
+    int32_t millis = (int32_t)(floor(local) - days*STRI__GREGO_MILLIS_PER_DAY);
+
+    int32_t y, m, d;
+    stri__grego_civil_from_days((int32_t)days, y, m, d);
+    if (y < STRI__GREGO_MIN_YEAR || y > STRI__GREGO_MAX_YEAR) return false;
+
+    for (size_t k = 0; k < m_items.size(); ++k) {
+        const Item& item = m_items[k];
+        switch (item.type) {
+            case STRI__ISO_LITERAL:  out.append(item.lit); break;
+            case STRI__ISO_YEAR:     stri__iso_put_digits(out, y, 4); break;
+            case STRI__ISO_MONTH:    stri__iso_put_digits(out, m, 2); break;
+            case STRI__ISO_DAY:      stri__iso_put_digits(out, d, 2); break;
+            case STRI__ISO_HOUR:     stri__iso_put_digits(out, millis/3600000, 2); break;
+            case STRI__ISO_MINUTE:   stri__iso_put_digits(out, (millis/60000)%60, 2); break;
+            case STRI__ISO_SECOND:   stri__iso_put_digits(out, (millis/1000)%60, 2); break;
+
+            case STRI__ISO_FRACTION: {
+                // left-justified, as in SimpleDateFormat::subFormat
+                int32_t ms = millis%1000;
+                if (item.width == 1)      stri__iso_put_digits(out, ms/100, 1);
+                else if (item.width == 2) stri__iso_put_digits(out, ms/10, 2);
+                else {
+                    stri__iso_put_digits(out, ms, 3);
+                    out.append(item.width-3, '0');
+                }
+                break;
+            }
+
+            case STRI__ISO_OFFSET: {
+                // as in TimeZoneFormat::formatOffsetISO8601
+                int32_t absoffset = (offset < 0) ? -offset : offset;
+                bool noseconds = !(item.width & STRI__ISO_OFFSET_SECONDS);
+                if ((item.width & STRI__ISO_OFFSET_UTC) &&
+                        (absoffset < 1000 || (noseconds && absoffset < 60000))) {
+                    out.push_back('Z');
+                    break;
+                }
+
+                int32_t fields[3];
+                fields[0] = absoffset/3600000;
+                fields[1] = (absoffset/60000)%60;
+                fields[2] = (absoffset/1000)%60;
+                if (fields[0] > 23) return false;
+
+                int minfields = (item.width & STRI__ISO_OFFSET_SHORT) ? 0 : 1;
+                int lastfield = noseconds ? 1 : 2;
+                while (lastfield > minfields && fields[lastfield] == 0)
+                    lastfield--;
+
+                bool negative = false;
+                if (offset < 0) {
+                    for (int l = 0; l <= lastfield; ++l)
+                        if (fields[l] != 0) negative = true;
+                }
+
+                out.push_back(negative ? '-' : '+');
+                for (int l = 0; l <= lastfield; ++l) {
+                    if (l > 0 && (item.width & STRI__ISO_OFFSET_EXTENDED))
+                        out.push_back(':');
+                    stri__iso_put_digits(out, fields[l], 2);
+                }
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+
+/** Parse a date-time
+ *
+ * Only the strings exactly of the form generated by format()
+ * are accepted (no leniency whatsoever), and the field values must be valid.
+ *
+ * @param str string (ASCII or UTF-8)
+ * @param n length of str in bytes
+ * @param t [out] milliseconds since the UNIX epoch
+ * @return false if ICU should be used instead
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+bool StriDateTimeISO::parse(const char* str, R_len_t n, UDate& t)
+{
+    if (!m_parse_ok) return false;
+
+    int32_t y = 0, m = 0, d = 0, hour = 0, minute = 0, second = 0, millis = 0;
+    int32_t offset = 0;
+    bool has_offset = false;
+
+    R_len_t j = 0;
+    for (size_t k = 0; k < m_items.size(); ++k) {
+        const Item& item = m_items[k];
+        switch (item.type) {
+            case STRI__ISO_LITERAL:
+                if (j+(R_len_t)item.lit.size() > n ||
+                        memcmp(str+j, item.lit.data(), item.lit.size()) != 0)
+                    return false;
+                j += (R_len_t)item.lit.size();
+                break;
+
+            case STRI__ISO_YEAR:   if (!stri__iso_get_digits(str, n, j, 4, y)) return false; break;
+            case STRI__ISO_MONTH:  if (!stri__iso_get_digits(str, n, j, 2, m)) return false; break;
+            case STRI__ISO_DAY:    if (!stri__iso_get_digits(str, n, j, 2, d)) return false; break;
+            case STRI__ISO_HOUR:   if (!stri__iso_get_digits(str, n, j, 2, hour)) return false; break;
+            case STRI__ISO_MINUTE: if (!stri__iso_get_digits(str, n, j, 2, minute)) return false; break;
+            case STRI__ISO_SECOND: if (!stri__iso_get_digits(str, n, j, 2, second)) return false; break;
+
+            case STRI__ISO_FRACTION: {
+                if (!stri__iso_get_digits(str, n, j, item.width, millis)) return false;
+                for (int l = item.width; l < 3; ++l) millis *= 10;
+                for (int l = item.width; l > 3; --l) millis /= 10;
+                break;
+            }
+
+            case STRI__ISO_OFFSET: {
+                has_offset = true;
+                if (j >= n) return false;
+                if (str[j] == 'Z' && (item.width & STRI__ISO_OFFSET_UTC)) {
+                    offset = 0;
+                    j++;
+                    break;
+                }
+                if (str[j] != '+' && str[j] != '-') return false;
+                int32_t sign = (str[j] == '-') ? -1 : 1;
+                j++;
+
+                int32_t oh = 0, om = 0, os = 0;
+                if (!stri__iso_get_digits(str, n, j, 2, oh)) return false;
+                // the offset ends the string or is followed by a literal,
+                // which never starts with a digit or a colon (see setPattern)
+                bool more = (j < n && ((str[j] >= '0' && str[j] <= '9') || str[j] == ':'));
+                if (more || !(item.width & STRI__ISO_OFFSET_SHORT)) {
+                    if ((item.width & STRI__ISO_OFFSET_EXTENDED) && (j >= n || str[j++] != ':'))
+                        return false;
+                    if (!stri__iso_get_digits(str, n, j, 2, om)) return false;
+                    more = (j < n && ((str[j] >= '0' && str[j] <= '9') || str[j] == ':'));
+                    if (more && (item.width & STRI__ISO_OFFSET_SECONDS)) {
+                        if ((item.width & STRI__ISO_OFFSET_EXTENDED) && str[j++] != ':')
+                            return false;
+                        if (!stri__iso_get_digits(str, n, j, 2, os)) return false;
+                    }
+                }
+                if (oh > 23 || om > 59 || os > 59) return false;
+                offset = sign*(oh*3600000 + om*60000 + os*1000);
+                break;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    if (j != n) return false;  // trailing characters
+
+    if (y < STRI__GREGO_MIN_YEAR || y > STRI__GREGO_MAX_YEAR ||
+            m < 1 || m > 12 || d < 1 || d > stri__grego_days_in_month(y, m) ||
+            hour > 23 || minute > 59 || second > 59)
+        return false;
+
+    double local = stri__grego_days_from_civil(y, m, d)*STRI__GREGO_MILLIS_PER_DAY +
+        (double)(((hour*60 + minute)*60 + second)*1000 + millis);
+
+    if (!has_offset && !getOffsetFromLocal(local, offset))
+        return false;
+
+    t = local - offset;
+    return true;
+}
@@ -0,0 +1,97 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef __stri_time_iso_h
+#define __stri_time_iso_h
+
+#include "stri_stringi.h"
+#include "stri_time_gregorian.h"
+#include <unicode/calendar.h>
+#include <vector>
+#include <string>
+
+
+/**
+ * A native formatter and parser for ISO 8601-like date-time patterns,
+ * e.g., "uuuu-MM-dd HH:mm:ss" or "uuuu-MM-dd'T'HH:mm:ss.SSSXXX",
+ * that works directly on ASCII bytes
+ *
+ * Only supports the Gregorian calendar (years 1600-9999) and
+ * locales using ASCII digits.  Produces the same results as
+ * ICU's SimpleDateFormat; everything it is not sure about
+ * (unsupported patterns, non-canonical input, wall times near time zone
+ * transitions, etc.) is reported by returning false,
+ * and should be delegated to ICU.
+ *
+ * Time zone offsets are taken from a StriZoneOffsetTable covering
+ * a window around the most recently processed date-time, hence
+ * consecutive date-times that are close to each other are dealt with quickly.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+class StriDateTimeISO {
+
+private:
+
+    struct Item {
+        int type;          ///< one of STRI__ISO_* (see the .cpp file)
+        int width;         ///< number of digits or offset style flags
+        std::string lit;   ///< literal text
+    };
+
+    std::vector<Item> m_items;
+    bool m_enabled;     ///< calendar and locale supported?
+    bool m_pattern_ok;  ///< current pattern supported?
+    bool m_parse_ok;    ///< current pattern determines the date completely?
+
+    TimeZone* m_tz;
+    StriZoneOffsetTable m_offsets;
+
+    StriDateTimeISO(const StriDateTimeISO&); /* no copy-able */
+    StriDateTimeISO& operator=(const StriDateTimeISO&);
+
+    bool prepareOffsets(double t);
+    bool getOffset(double t, int32_t& offset);
+    bool getOffsetFromLocal(double local, int32_t& offset);
+
+public:
+
+    StriDateTimeISO(const Calendar* cal, const char* locale);
+    ~StriDateTimeISO();
+
+    bool setPattern(const char* pattern);
+    bool format(UDate t, std::string& out);
+    bool parse(const char* str, R_len_t n, UDate& t);
+};
+
+#endif
@@ -34,13 +34,21 @@
 #include "stri_container_utf8.h"
 #include "stri_string8buf.h"
 #include "stri_brkiter.h"
+#include "stri_parallel.h"
 #include <unicode/ucasemap.h>
+#include <unicode/uloc.h>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 
 #define STRI_CASEMAP_TOLOWER   1
 #define STRI_CASEMAP_TOUPPER   2
 #define STRI_CASEMAP_CASEFOLD  3
 
+/// max number of results staged before being copied to R in multiple threads
+#define STRI_CASEMAP_BATCH     65536
+
 
 /**
  *  Convert case (TitleCase)
@@ -138,6 +146,147 @@ SEXP stri_trans_totitle(SEXP str, SEXP opts_brkiter) {
 }
 
 
+/** Can ASCII strings be case-mapped byte by byte, i.e., does the locale
+ *  use the root case mapping rules? (cf. ucase_getCaseLocale;
+ *  Turkish and Azeri map i and I to non-ASCII letters; Lithuanian,
+ *  Greek, and Dutch are excluded for good measure)
+ *
+ * @param qloc locale identifier or NULL for default locale
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__casemap_ascii_ok(const char* qloc)
+{
+    char lang[ULOC_LANG_CAPACITY];
+    UErrorCode status = U_ZERO_ERROR;
+    uloc_getLanguage(qloc, lang, ULOC_LANG_CAPACITY, &status);
+    if (U_FAILURE(status) || status == U_STRING_NOT_TERMINATED_WARNING)
+        return false;
+
+    const char* special[] = {
+        "tr", "tur", "az", "aze", "lt", "lit", "el", "ell", "nl", "nld"
+    };
+    for (size_t k = 0; k < sizeof(special)/sizeof(special[0]); ++k)
+        if (!strcmp(lang, special[k])) return false;
+    return true;
+}
+
+
+/** Convert case of an ASCII string (root locale rules)
+ *
+ * The loops are branch-free so that compilers can vectorise them.
+ *
+ * @param _type STRI_CASEMAP_TOLOWER, STRI_CASEMAP_TOUPPER,
+ *    or STRI_CASEMAP_CASEFOLD
+ * @param buf output buffer, at least str_cur_n bytes
+ * @param str_cur_s string
+ * @param str_cur_n number of bytes in str_cur_s
+ * @return false if the string is left unchanged (buf is then not written)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__casemap_string_ascii(int _type, char* buf,
+    const char* str_cur_s, R_len_t str_cur_n)
+{
+    const uint8_t* s = (const uint8_t*)str_cur_s;
+    uint8_t* t = (uint8_t*)buf;
+    // letters to be changed: [from, from+26)
+    uint8_t from = (_type == STRI_CASEMAP_TOUPPER)?(uint8_t)'a':(uint8_t)'A';
+
+    uint8_t any = 0;
+    for (R_len_t j = 0; j < str_cur_n; ++j)
+        any |= (uint8_t)((uint8_t)(s[j]-from) < 26);
+    if (!any) return false;
+
+    if (_type == STRI_CASEMAP_TOUPPER) {
+        for (R_len_t j = 0; j < str_cur_n; ++j)
+            t[j] = s[j] ^ (uint8_t)(((uint8_t)(s[j]-from) < 26) << 5);
+    }
+    else {
+        for (R_len_t j = 0; j < str_cur_n; ++j)
+            t[j] = s[j] | (uint8_t)(((uint8_t)(s[j]-from) < 26) << 5);
+    }
+    return true;
+}
+
+
+/** Convert case of a single UTF-8 string
+ *
+ * @param ucasemap case mapping object
+ * @param _type STRI_CASEMAP_TOLOWER, STRI_CASEMAP_TOUPPER,
+ *    or STRI_CASEMAP_CASEFOLD
+ * @param ascii_ok whether ASCII strings may be mapped byte by byte,
+ *    see stri__casemap_ascii_ok
+ * @param buf output buffer, grown if necessary
+ * @param buf_used number of bytes already used in buf; the result
+ *    is stored right after them
+ * @param str string
+ * @return number of bytes in the result or -1 if the string is
+ *    left unchanged (buf is then not written)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    separated from stri_trans_casemap; ASCII fast path;
+ *    unchanged strings are detected; output appended to a growing buffer
+ */
+static int stri__casemap_string(UCaseMap* ucasemap, int _type, bool ascii_ok,
+    String8buf& buf, size_t buf_used, const String8& str)
+{
+    const char* str_cur_s = str.c_str();
+    R_len_t str_cur_n = str.length();
+
+    if (ascii_ok && str.isASCII()) {
+        buf.grow(buf_used+str_cur_n);
+        if (!stri__casemap_string_ascii(_type, buf.data()+buf_used, str_cur_s, str_cur_n))
+            return -1;
+        return str_cur_n;
+    }
+
+    // usually enough; otherwise, ICU tells us how much it needs
+    buf.grow(buf_used+2*(size_t)str_cur_n+16);
+
+    UErrorCode status;
+    int buf_need;
+    bool retry = false;
+    while (true) {
+        status = U_ZERO_ERROR;
+        char* buf_cur = buf.data()+buf_used;
+        int32_t buf_cur_size = (int32_t)std::min(buf.size()-buf_used, (size_t)INT32_MAX);
+        if (_type == STRI_CASEMAP_TOLOWER) {
+            buf_need = ucasemap_utf8ToLower(
+                ucasemap, buf_cur, buf_cur_size, str_cur_s, str_cur_n, &status
+            );
+        }
+        else if (_type == STRI_CASEMAP_TOUPPER) {
+            buf_need = ucasemap_utf8ToUpper(
+                ucasemap, buf_cur, buf_cur_size, str_cur_s, str_cur_n, &status
+            );
+        }
+        else {
+            buf_need = ucasemap_utf8FoldCase(
+                ucasemap, buf_cur, buf_cur_size, str_cur_s, str_cur_n, &status
+            );
+        }
+
+        if (!U_FAILURE(status)) break;
+
+        if (!retry && status == U_BUFFER_OVERFLOW_ERROR) {
+            buf.grow(buf_used+buf_need);
+            // we now have the buffer size required to complete this op
+            retry = true;
+        }
+        else {
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */}) // this shouldn't happen
+        }
+    }
+
+    if (buf_need == str_cur_n && memcmp(buf.data()+buf_used, str_cur_s, (size_t)str_cur_n) == 0)
+        return -1;
+
+    return buf_need;
+}
+
+
 /**
  *  Convert case (upper, lowercase, fold)
  *
@@ -180,6 +329,10 @@ SEXP stri_trans_totitle(SEXP str, SEXP opts_brkiter) {
  *
  * @version 1.6.1 (Marek Gagolewski, 2021-04-30)
  *    add casefold
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    multithreading; ASCII fast path; strings that are left unchanged
+ *    are returned as-is (no new CHARSXPs) unless they are natively encoded
 */
 SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
 {
@@ -190,6 +343,7 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
 
     // version 0.2-1 - Does not work with ICU 4.8 (but we require ICU >= 50)
     UCaseMap* ucasemap = NULL;
+    std::vector<UCaseMap*> ucasemap_workers;  // used in multiple threads
 
     STRI__ERROR_HANDLER_BEGIN(1)
     UErrorCode status = U_ZERO_ERROR;
@@ -200,76 +354,98 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
     // NOTE: we can't check if there submitted locale is valid,
     // because there is no API for it [ULOC_VALID_LOCALE]
 
+    // case folding (U_FOLD_CASE_DEFAULT) does not depend on the locale
+    bool ascii_ok = (_type == STRI_CASEMAP_CASEFOLD || stri__casemap_ascii_ok(qloc));
+
     R_len_t str_n = LENGTH(str);
     StriContainerUTF8 str_cont(str, str_n);
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, str_n));
 
-
-    // STEP 1.
-    // Estimate the required buffer length
     // Notice: The resulting number of code points may be larger or smaller than
-    // the number before case mapping
-    R_len_t bufsize = str_cont.getMaxNumBytes();
-    bufsize += 10; // a small margin
-    String8buf buf(bufsize);
-
-    // STEP 2.
-    // Do case folding
-    for (R_len_t i = str_cont.vectorize_init();
-            i != str_cont.vectorize_end();
-            i = str_cont.vectorize_next(i))
-    {
-        if (str_cont.isNA(i)) {
-            SET_STRING_ELT(ret, i, NA_STRING);
-            continue;
+    // the number before case mapping; the buffers grow as needed
+    int nworkers = StriParallel::getNumWorkers(str_n);
+    if (nworkers > 1) {
+        // UCaseMap is not thread-safe: worker 0 uses ucasemap
+        for (int w = 1; w < nworkers; ++w) {
+            status = U_ZERO_ERROR;
+            ucasemap_workers.push_back(ucasemap_open(qloc, U_FOLD_CASE_DEFAULT, &status));
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
 
-        R_len_t str_cur_n     = str_cont.get(i).length();
-        const char* str_cur_s = str_cont.get(i).c_str();
-
-        int buf_need;
-        bool retry = false;
-        while (true) {
-            status = U_ZERO_ERROR;
-            if (_type == STRI_CASEMAP_TOLOWER) {
-                buf_need = ucasemap_utf8ToLower(
-                    ucasemap, buf.data(), buf.size(),
-                    (const char*)str_cur_s, str_cur_n, &status
-                );
-            }
-            else if (_type == STRI_CASEMAP_TOUPPER) {
-                buf_need = ucasemap_utf8ToUpper(
-                    ucasemap, buf.data(), buf.size(),
-                    (const char*)str_cur_s, str_cur_n, &status
-                );
+        // each worker appends the results to its own buffer
+        std::vector<String8buf> bufs(nworkers);
+        std::vector<size_t> bufs_used(nworkers);
+        R_len_t batch_max = std::min(str_n, (R_len_t)STRI_CASEMAP_BATCH);
+        std::vector<int> mapped_worker(batch_max);
+        std::vector<size_t> mapped_start(batch_max);
+        std::vector<int> mapped_n(batch_max);  // -1 == unchanged
+        for (R_len_t batch = 0; batch < str_n; batch += STRI_CASEMAP_BATCH) {
+            R_len_t batch_n = std::min(str_n-batch, (R_len_t)STRI_CASEMAP_BATCH);
+            std::fill(bufs_used.begin(), bufs_used.end(), 0);
+            StriParallel::run(batch_n, nworkers,
+                [&](R_xlen_t from, R_xlen_t to, int worker) {
+                    UCaseMap* cur_ucasemap = (worker == 0)?ucasemap:ucasemap_workers[worker-1];
+                    for (R_xlen_t j = from; j < to; ++j) {
+                        R_len_t i = batch+(R_len_t)j;
+                        if (str_cont.isNA(i)) continue;
+                        int buf_need = stri__casemap_string(cur_ucasemap, _type, ascii_ok,
+                            bufs[worker], bufs_used[worker], str_cont.get(i));
+                        mapped_worker[j] = worker;
+                        mapped_start[j] = bufs_used[worker];
+                        mapped_n[j] = buf_need;
+                        if (buf_need > 0) bufs_used[worker] += buf_need;
+                    }
+                });
+
+            // R API: in the main thread only
+            for (R_len_t j = 0; j < batch_n; ++j) {
+                R_len_t i = batch+j;
+                SEXP src;
+                if (str_cont.isNA(i))
+                    SET_STRING_ELT(ret, i, NA_STRING);
+                else if (mapped_n[j] < 0 && (src = str_cont.getSourceUTF8(i)) != NULL)
+                    SET_STRING_ELT(ret, i, src);
+                else if (mapped_n[j] < 0)
+                    SET_STRING_ELT(ret, i, Rf_mkCharLenCE(str_cont.get(i).c_str(),
+                        str_cont.get(i).length(), CE_UTF8));
+                else
+                    SET_STRING_ELT(ret, i, Rf_mkCharLenCE(
+                        bufs[mapped_worker[j]].data()+mapped_start[j], mapped_n[j], CE_UTF8));
             }
-            else {
-                buf_need = ucasemap_utf8FoldCase(
-                    ucasemap, buf.data(), buf.size(),
-                    (const char*)str_cur_s, str_cur_n, &status
-                );
+        }
+    }
+    else {
+        String8buf buf(str_cont.getMaxNumBytes()+10);
+        for (R_len_t i = str_cont.vectorize_init();
+                i != str_cont.vectorize_end();
+                i = str_cont.vectorize_next(i))
+        {
+            if (str_cont.isNA(i)) {
+                SET_STRING_ELT(ret, i, NA_STRING);
+                continue;
             }
 
-            if (!U_FAILURE(status)) break;
-
-            if (!retry) {
-                buf.resize(buf_need, false/*destroy contents*/);
-                // we now have the buffer size required to complete this op
-                retry = true;
-            }
-            else {
-                STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */}) // this shouldn't happen
-            }
+            int buf_need = stri__casemap_string(ucasemap, _type, ascii_ok,
+                buf, 0, str_cont.get(i));
+            SEXP src;
+            if (buf_need < 0 && (src = str_cont.getSourceUTF8(i)) != NULL)
+                SET_STRING_ELT(ret, i, src);
+            else if (buf_need < 0)
+                SET_STRING_ELT(ret, i, Rf_mkCharLenCE(str_cont.get(i).c_str(),
+                    str_cont.get(i).length(), CE_UTF8));
+            else
+                SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf_need, CE_UTF8));
         }
-
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf_need, CE_UTF8));
     }
 
     if (ucasemap) {
         ucasemap_close(ucasemap);
         ucasemap = NULL;
     }
+    for (size_t w = 0; w < ucasemap_workers.size(); ++w)
+        if (ucasemap_workers[w]) ucasemap_close(ucasemap_workers[w]);
+    ucasemap_workers.clear();
     STRI__UNPROTECT_ALL
     return ret;
 
@@ -278,6 +454,9 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
             ucasemap_close(ucasemap);
             ucasemap = NULL;
         }
+        for (size_t w = 0; w < ucasemap_workers.size(); ++w)
+            if (ucasemap_workers[w]) ucasemap_close(ucasemap_workers[w]);
+        ucasemap_workers.clear();
     })
 }
 
@@ -30,8 +30,14 @@
  */
 
 #include "stri_stringi.h"
+#include "stri_container_utf8.h"
 #include "stri_container_utf16.h"
+#include "stri_parallel.h"
+#include "stri_ucnv.h"
 #include <unicode/normalizer2.h>
+#include <unicode/bytestream.h>
+#include <string>
+#include <vector>
 
 
 #define STRI_UNINORM_NFC 10
@@ -94,6 +100,71 @@ const Normalizer2* stri__normalizer_get(int _type)
 }
 
 
+/** Normalise a valid UTF-8 string
+ *
+ * Thread-safe.
+ *
+ * @param normalizer
+ * @param s string
+ * @param n number of bytes in s
+ * @param out [out] the normalised string is appended here
+ *    (unless s is already normalised)
+ * @return false if s is already normalised (and out is left as is)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__trans_nf_utf8(const Normalizer2* normalizer,
+    const char* s, R_len_t n, std::string& out)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    StringPiece sp(s, n);
+
+    if (stri__utf8_invalid_offset(s, n) >= 0) {
+        // as before: ill-formed sequences become U+FFFD in UTF-16
+        UnicodeString us = UnicodeString::fromUTF8(sp);
+        normalizer->normalize(us, status).toUTF8String(out);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        return true;
+    }
+
+    if (normalizer->isNormalizedUTF8(sp, status)) {  // quick check, mostly
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        return false;
+    }
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+    StringByteSink<std::string> sink(&out);
+    normalizer->normalizeUTF8(0, sp, sink, NULL, status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    return true;
+}
+
+
+/** Check if a UTF-8 string is normalised
+ *
+ * Thread-safe.
+ *
+ * @param normalizer
+ * @param s string
+ * @param n number of bytes in s
+ * @return normalised?
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static bool stri__trans_isnf_utf8(const Normalizer2* normalizer,
+    const char* s, R_len_t n)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    bool ret;
+    if (stri__utf8_invalid_offset(s, n) >= 0)  // as before: U+FFFD in UTF-16
+        ret = normalizer->isNormalized(UnicodeString::fromUTF8(StringPiece(s, n)), status);
+    else
+        ret = normalizer->isNormalizedUTF8(StringPiece(s, n), status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    return ret;
+}
+
+
 /**
  * Perform Unicode Normalization
  *
@@ -117,6 +188,10 @@ const Normalizer2* stri__normalizer_get(int _type)
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    This is now an internal function
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    multithreading; UTF-8 strings are normalised directly
+ *    (no UTF-16 round trip), those already normalised are returned as-is
  */
 SEXP stri_trans_nf(SEXP str, int type)
 {
@@ -125,30 +200,94 @@ SEXP stri_trans_nf(SEXP str, int type)
     // FDFA>0635 0644 0649 0020 0627 0644 0644 0647 0020
     //      0639 0644 064A 0647 0020 0648 0633 0644 0645
 
-    // C API will not be faster here
-    // In ICU 52.1 unorm2_normalize does UnicodeString destString(dest, 0, capacity);
-    // and so on, thus it is a simple wrapper for C++ API
-
     const Normalizer2* normalizer =
         stri__normalizer_get(type); // auto `type` check here, call before ERROR_HANDLER
 
+    // ASCII is invariant under all the normalisation forms but NFKC_Casefold
+    bool ascii_normalized = (type != STRI_UNINORM_NFKC_CF);
+
     PROTECT(str = stri__prepare_arg_string(str, "str"));    // prepare string argument
     R_len_t str_length = LENGTH(str);
 
+    StriContainerUTF16* str_cont = NULL;  // for strings in other encodings
     STRI__ERROR_HANDLER_BEGIN(1)
-    StriContainerUTF16 str_cont(str, str_length, false); // writable, no recycle
-
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(STRSXP, str_length));
+
+    // UTF-8 strings are dealt with later, possibly in multiple threads;
+    // CHARSXPs are only accessed here, in the main thread
+    StriUcnv ucnvNative(NULL);
+    std::vector<R_len_t> deferred;
+    std::vector<const char*> deferred_s;
+    std::vector<R_len_t> deferred_n;
     for (R_len_t i=0; i<str_length; ++i) {
-        if (str_cont.isNA(i)) continue;
-        UErrorCode status = U_ZERO_ERROR;
-        str_cont.set(i, normalizer->normalize(str_cont.get(i), status));
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        SEXP curs = STRING_ELT(str, i);
+        if (curs == NA_STRING) {
+            SET_STRING_ELT(ret, i, NA_STRING);
+        }
+        else if (IS_ASCII(curs) && ascii_normalized) {
+            SET_STRING_ELT(ret, i, curs);
+        }
+        else if (IS_ASCII(curs) || IS_UTF8(curs) ||
+                (!IS_LATIN1(curs) && !IS_BYTES(curs) && ucnvNative.isUTF8())) {
+            // unless it needs normalising; native strings get marked as UTF-8
+            if (StriContainerUTF8::isUTF8Source(curs))
+                SET_STRING_ELT(ret, i, curs);
+            else
+                SET_STRING_ELT(ret, i, Rf_mkCharLenCE(CHAR(curs), LENGTH(curs), CE_UTF8));
+            deferred.push_back(i);
+            deferred_s.push_back(CHAR(curs));
+            deferred_n.push_back(LENGTH(curs));
+        }
+        else {
+            // e.g., latin1: as before
+            if (!str_cont) str_cont = new StriContainerUTF16(str, str_length);
+            UErrorCode status = U_ZERO_ERROR;
+            UnicodeString out = normalizer->normalize(str_cont->get(i), status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            std::string out8;
+            out.toUTF8String(out8);
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(out8.c_str(), (int)out8.size(), CE_UTF8));
+        }
     }
 
+    // Normalizer2 is thread-safe; each worker stores the strings that
+    // have changed in its own buffer
+    R_xlen_t ndeferred = (R_xlen_t)deferred.size();
+    int nworkers = StriParallel::getNumWorkers(ndeferred);
+    std::vector<std::string> out_buf(nworkers);
+    std::vector< std::vector< std::pair<R_len_t, size_t> > > out_idx(nworkers);  // (i, end)
+    StriParallel::run(ndeferred, nworkers,
+        [&](R_xlen_t from, R_xlen_t to, int worker) {
+            for (R_xlen_t d = from; d < to; ++d) {
+                if (stri__trans_nf_utf8(normalizer, deferred_s[d], deferred_n[d], out_buf[worker]))
+                    out_idx[worker].push_back(std::make_pair(deferred[d], out_buf[worker].size()));
+            }
+        });
+
+    for (int w=0; w<nworkers; ++w) {
+        size_t start = 0;
+        for (size_t k=0; k<out_idx[w].size(); ++k) {
+            size_t end = out_idx[w][k].second;
+            SET_STRING_ELT(ret, out_idx[w][k].first,
+                Rf_mkCharLenCE(out_buf[w].data()+start, (int)(end-start), CE_UTF8));
+            start = end;
+        }
+    }
+
+    if (str_cont) {
+        delete str_cont;
+        str_cont = NULL;
+    }
     // normalizer shall not be deleted at all
     STRI__UNPROTECT_ALL
-    return str_cont.toR();
-    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+    return ret;
+    STRI__ERROR_HANDLER_END({
+        if (str_cont) {
+            delete str_cont;
+            str_cont = NULL;
+        }
+    })
 }
 
 
@@ -173,43 +312,76 @@ SEXP stri_trans_nf(SEXP str, int type)
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    This is now an internal function
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    UTF-8 strings are checked directly (no UTF-16 round trip);
+ *    multithreading
  */
 SEXP stri_trans_isnf(SEXP str, int type)
 {
     const Normalizer2* normalizer =
         stri__normalizer_get(type); // auto `type` check here, call before ERROR_HANDLER
 
+    bool ascii_normalized = (type != STRI_UNINORM_NFKC_CF);
+
     PROTECT(str = stri__prepare_arg_string(str, "str"));    // prepare string argument
     R_len_t str_length = LENGTH(str);
 
+    StriContainerUTF16* str_cont = NULL;  // for strings in other encodings
     STRI__ERROR_HANDLER_BEGIN(1)
-    StriContainerUTF16 str_cont(str, str_length);
-
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, str_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = str_cont.vectorize_init();
-            i != str_cont.vectorize_end();
-            i = str_cont.vectorize_next(i))
-    {
-        if (str_cont.isNA(i)) {
+    // UTF-8 strings are dealt with later, possibly in multiple threads
+    StriUcnv ucnvNative(NULL);
+    std::vector<R_len_t> deferred;
+    std::vector<const char*> deferred_s;
+    std::vector<R_len_t> deferred_n;
+    for (R_len_t i=0; i<str_length; ++i) {
+        SEXP curs = STRING_ELT(str, i);
+        if (curs == NA_STRING) {
             ret_tab[i] = NA_LOGICAL;
-            continue;
         }
-
-        // C API will not be faster here
-        // as it is a simple wrapper for C++ API
-
-        UErrorCode status = U_ZERO_ERROR;
-        ret_tab[i] = normalizer->isNormalized(str_cont.get(i), status) ? TRUE : FALSE;
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        else if (IS_ASCII(curs) && ascii_normalized) {
+            ret_tab[i] = TRUE;
+        }
+        else if (IS_ASCII(curs) || IS_UTF8(curs) ||
+                (!IS_LATIN1(curs) && !IS_BYTES(curs) && ucnvNative.isUTF8())) {
+            deferred.push_back(i);
+            deferred_s.push_back(CHAR(curs));
+            deferred_n.push_back(LENGTH(curs));
+        }
+        else {
+            if (!str_cont) str_cont = new StriContainerUTF16(str, str_length);
+            UErrorCode status = U_ZERO_ERROR;
+            ret_tab[i] = normalizer->isNormalized(str_cont->get(i), status) ? TRUE : FALSE;
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        }
     }
 
+    R_xlen_t ndeferred = (R_xlen_t)deferred.size();
+    StriParallel::run(ndeferred, StriParallel::getNumWorkers(ndeferred),
+        [&](R_xlen_t from, R_xlen_t to, int /*worker*/) {
+            for (R_xlen_t d = from; d < to; ++d) {
+                ret_tab[deferred[d]] = stri__trans_isnf_utf8(normalizer,
+                    deferred_s[d], deferred_n[d]) ? TRUE : FALSE;
+            }
+        });
+
+    if (str_cont) {
+        delete str_cont;
+        str_cont = NULL;
+    }
     // normalizer shall not be deleted at all
     STRI__UNPROTECT_ALL
     return ret;
-    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+    STRI__ERROR_HANDLER_END({
+        if (str_cont) {
+            delete str_cont;
+            str_cont = NULL;
+        }
+    })
 }
 
 
@@ -65,6 +65,11 @@ void stri__split_codepoints(vector<UChar32>& out, const char* s, int n) {
  *
  * @version 1.3.2 (Marek Gagolewski, 2019-02-20)
  *     BUGFIX: overlapping maps (#343)
+ *
+ * @version 1.8.8 (2026-10-19)
+ *     two-stage lookup table instead of a linear search; byte-level
+ *     translation if all the code points are ASCII; strings
+ *     that are left unchanged are returned as-is unless natively encoded
  */
 SEXP stri_trans_char(SEXP str, SEXP pattern, SEXP replacement) {
     PROTECT(str          = stri__prepare_arg_string(str, "str"));
@@ -103,10 +108,35 @@ SEXP stri_trans_char(SEXP str, SEXP pattern, SEXP replacement) {
     }
 
 
+    // code point -> replacement: stage1[c>>8] gives the offset in stage2
+    // of the block of 256 code points that c belongs to,
+    // or -1 if none of them is to be replaced;
+    // considering only the first m elements in d_pat and d_rep, the last wins
+    std::vector<R_len_t> stage1((UCHAR_MAX_VALUE>>8)+1, -1);
+    std::vector<UChar32> stage2;
+    bool all_ascii = true;
+    for (R_len_t k=0; k<m; ++k) {
+        UChar32 p = d_pat[k];
+        if (stage1[p>>8] < 0) {
+            stage1[p>>8] = (R_len_t)stage2.size();
+            for (UChar32 b=0; b<256; ++b)
+                stage2.push_back((p & ~0xff) | b);
+        }
+        stage2[stage1[p>>8] + (p & 0xff)] = d_rep[k];
+
+        if (p > ASCII_MAXCHARCODE || d_rep[k] > ASCII_MAXCHARCODE)
+            all_ascii = false;
+    }
+
+    // the byte-level translation table (ASCII bytes only)
+    uint8_t ascii_map[ASCII_MAXCHARCODE+1];
+    for (int b=0; b<=ASCII_MAXCHARCODE; ++b)
+        ascii_map[b] = (uint8_t)((stage1[0] < 0)?b:stage2[stage1[0]+b]);
+
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
 
-    std::vector<char> buf;
+    String8buf buf(str_cont.getMaxNumBytes());
     for (R_len_t i = str_cont.vectorize_init();
             i != str_cont.vectorize_end();
             i = str_cont.vectorize_next(i))
@@ -115,46 +145,49 @@ SEXP stri_trans_char(SEXP str, SEXP pattern, SEXP replacement) {
             SET_STRING_ELT(ret, i, NA_STRING);
             continue;
         }
-        buf.clear();
 
         const char* s = str_cont.get(i).c_str();
         R_len_t n = str_cont.get(i).length();
-
-        UChar32 c = 0;
-        R_len_t j = 0; // current pos
-        while (j < n) {
-            U8_NEXT(s, j, n, c);
-            if (c < 0) throw StriException(MSG__INVALID_UTF8);
-
-            // considering only the first m elements in d_pat and d_rep, from last
-            for (R_len_t k=m-1; k>=0; --k) {
-                if (d_pat[k] == c) {
-                    c = d_rep[k];
-                    break;
-                }
+        bool changed = false;
+        R_len_t k = 0;  // number of bytes in buf
+
+        if (all_ascii) {
+            // UTF-8 multibyte sequences consist of non-ASCII bytes only
+            if (!str_cont.get(i).isASCII() && stri__utf8_invalid_offset(s, n) >= 0)
+                throw StriException(MSG__INVALID_UTF8);
+
+            buf.grow(n);
+            uint8_t* out = (uint8_t*)buf.data();
+            for (k=0; k<n; ++k) {
+                uint8_t b = (uint8_t)s[k];
+                out[k] = (b <= ASCII_MAXCHARCODE)?ascii_map[b]:b;
+                changed |= (out[k] != b);
             }
-
-            // U8_APPEND_UNSAFE(buf, /end/, c)
-            uint32_t __uc=(c);
-            if(__uc<=0x7f) {
-                buf.push_back((uint8_t)__uc);
-            } else {
-                if(__uc<=0x7ff) {
-                    buf.push_back((uint8_t)((__uc>>6)|0xc0));
-                } else {
-                    if(__uc<=0xffff) {
-                        buf.push_back((uint8_t)((__uc>>12)|0xe0));
-                    } else {
-                        buf.push_back((uint8_t)((__uc>>18)|0xf0));
-                        buf.push_back((uint8_t)(((__uc>>12)&0x3f)|0x80));
-                    }
-                    buf.push_back((uint8_t)(((__uc>>6)&0x3f)|0x80));
+        }
+        else {
+            buf.grow(4*(size_t)n);  // each code point takes at most 4 bytes
+            uint8_t* out = (uint8_t*)buf.data();
+            UChar32 c = 0;
+            R_len_t j = 0; // current pos
+            while (j < n) {
+                U8_NEXT(s, j, n, c);
+                if (c < 0) throw StriException(MSG__INVALID_UTF8);
+
+                R_len_t off = stage1[c>>8];
+                if (off >= 0 && stage2[off + (c & 0xff)] != c) {
+                    c = stage2[off + (c & 0xff)];
+                    changed = true;
                 }
-                buf.push_back((uint8_t)((__uc&0x3f)|0x80));
+
+                U8_APPEND_UNSAFE(out, k, c);
             }
         }
 
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf.size(), CE_UTF8));
+        SEXP src;
+        if (!changed && (src = str_cont.getSourceUTF8(i)) != NULL)
+            SET_STRING_ELT(ret, i, src);
+        else
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), k, CE_UTF8));
     }
 
     STRI__UNPROTECT_ALL
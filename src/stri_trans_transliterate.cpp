@@ -32,9 +32,33 @@
 
 #include "stri_stringi.h"
 #include "stri_container_utf16.h"
+#include "stri_icu_cache.h"
+#include "stri_parallel.h"
 #include <unicode/translit.h>
 #include <unicode/strenum.h>
 #include <string>
+#include <vector>
+
+
+/* max number of compiled transliterators kept in the cache */
+#define STRI__TRANSLITERATOR_CACHE_MAX_SIZE 64
+
+/* transliteration is slow, hence smaller chunks are worth a thread */
+#define STRI__TRANSLITERATE_MIN_CHUNK 128
+
+
+static StriICUCache<Transliterator> stri__transliterator_cache_obj(STRI__TRANSLITERATOR_CACHE_MAX_SIZE);
+
+
+/** Compiled transliterators, keyed by the kind (ID or rules),
+ *  direction, and ID/rules (UTF-8)
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+StriICUCache<Transliterator>& stri__transliterator_cache()
+{
+    return stri__transliterator_cache_obj;
+}
 
 
 /** List available transliterators
@@ -102,6 +126,10 @@ SEXP stri_trans_list()
  *
  * @version 0.2-2 (Marek Gagolewski, 2014-04-19)
  * @version 1.6.3 (Marek Gagolewski, 2021-06-03)  rules, forward
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    reuse compiled transliterators from the cache; multithreading,
+ *    each worker uses its own clone
  */
 SEXP stri_trans_general(SEXP str, SEXP id, SEXP rules, SEXP forward)
 {
@@ -112,7 +140,7 @@ SEXP stri_trans_general(SEXP str, SEXP id, SEXP rules, SEXP forward)
 
     R_len_t str_length = LENGTH(str);
 
-    Transliterator* trans = NULL;
+    std::vector<Transliterator*> trans;  // one per worker
     STRI__ERROR_HANDLER_BEGIN(2)
     StriContainerUTF16 id_cont(id, 1);
     if (id_cont.isNA(0)) {
@@ -120,41 +148,67 @@ SEXP stri_trans_general(SEXP str, SEXP id, SEXP rules, SEXP forward)
         return stri__vector_NA_strings(str_length);
     }
 
-    UErrorCode status = U_ZERO_ERROR;
-    UParseError parserr;
-    if (!rules_val)
-        trans = Transliterator::createInstance(
-            id_cont.get(0),
-            (forward_val?UTRANS_FORWARD:UTRANS_REVERSE),
-            status
-        );
-    else
-        trans = Transliterator::createFromRules(
-            UnicodeString("Rule-based Transliterator"),  // can be anything
-            id_cont.get(0),
-            (forward_val?UTRANS_FORWARD:UTRANS_REVERSE),
-            parserr,
-            status
-        );
-    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    std::string trans_key(rules_val?"R":"I");
+    trans_key += (forward_val?"F:":"R:");
+    id_cont.get(0).toUTF8String(trans_key);
+
+    trans.push_back(stri__transliterator_cache().get(trans_key));
+    if (!trans[0]) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError parserr;
+        if (!rules_val)
+            trans[0] = Transliterator::createInstance(
+                id_cont.get(0),
+                (forward_val?UTRANS_FORWARD:UTRANS_REVERSE),
+                status
+            );
+        else
+            trans[0] = Transliterator::createFromRules(
+                UnicodeString("Rule-based Transliterator"),  // can be anything
+                id_cont.get(0),
+                (forward_val?UTRANS_FORWARD:UTRANS_REVERSE),
+                parserr,
+                status
+            );
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        stri__transliterator_cache().put(trans_key, trans[0]);
+    }
 
     StriContainerUTF16 str_cont(str, str_length, false); // writable, no recycle
 
-    for (R_len_t i=0; i<str_length; ++i) {
-        if (str_cont.isNA(i)) continue;
-        trans->transliterate(str_cont.getWritable(i));
-    }
+    // a Transliterator is not thread-safe, so each worker gets its own clone
+    // (ICU still serialises the rule-based ones internally);
+    // each thread modifies distinct elements
+    int nworkers = StriParallel::getNumWorkers(str_length, STRI__TRANSLITERATE_MIN_CHUNK);
+    if (nworkers > 1) {
+        for (int w=1; w<nworkers; ++w) {
+            trans.push_back(trans[0]->clone());
+            if (!trans[w]) throw StriException(MSG__MEM_ALLOC_ERROR);
+        }
 
-    if (trans) {
-        delete trans;
-        trans = NULL;
+        StriParallel::run(str_length, nworkers,
+            [&](R_xlen_t from, R_xlen_t to, int worker) {
+                for (R_xlen_t i=from; i<to; ++i) {
+                    if (str_cont.isNA(i)) continue;
+                    trans[worker]->transliterate(str_cont.getWritable(i));
+                }
+            });
+    }
+    else {
+        for (R_len_t i=0; i<str_length; ++i) {
+            if (str_cont.isNA(i)) continue;
+            trans[0]->transliterate(str_cont.getWritable(i));
+        }
     }
+
+    for (size_t w=0; w<trans.size(); ++w)
+        delete trans[w];
+    trans.clear();
     STRI__UNPROTECT_ALL
     return str_cont.toR();
     STRI__ERROR_HANDLER_END(
-        if (trans) {
-            delete trans;
-            trans = NULL;
-        }
+        for (size_t w=0; w<trans.size(); ++w)
+            delete trans[w];
+        trans.clear();
     )
 }
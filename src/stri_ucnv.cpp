@@ -31,6 +31,23 @@
 
 #include "stri_stringi.h"
 #include "stri_ucnv.h"
+#include <map>
+
+
+/* Process-wide pool of idle converters, keyed by the canonical converter
+ * name and whether our callbacks are registered. Opening table-based
+ * converters is expensive relative to converting short strings, hence
+ * StriUcnv returns them here instead of closing them.
+ *
+ * Only accessed from the main thread (like the rest of the ICU converter API
+ * in stringi, see stri_enc_set).
+ */
+#define STRI__UCNV_POOL_MAX_IDLE 8 /* per key */
+
+typedef std::map< std::pair<std::string, bool>, std::vector<UConverter*> > StriUcnvPoolMap;
+static StriUcnvPoolMap stri__ucnv_pool;
+static double stri__ucnv_pool_hits = 0.0;
+static double stri__ucnv_pool_misses = 0.0;
 
 
 /**
@@ -50,6 +67,9 @@
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-01)
  *    don't register callbacks by default
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    reuse converters from the pool
  */
 void StriUcnv::openConverter(bool register_callbacks) {
     if (m_ucnv)
@@ -57,6 +77,27 @@ void StriUcnv::openConverter(bool register_callbacks) {
 
     UErrorCode status = U_ZERO_ERROR;
 
+    // canonical name, so that aliases share the same pool entry;
+    // names with options (e.g., "UTF-16,version=1") are used as-is
+    const char* name = m_name ? m_name : ucnv_getDefaultName();
+    const char* canname = ucnv_getAlias(name, 0, &status);
+    if (U_FAILURE(status) || !canname)
+        canname = name;
+    m_key = canname;
+    m_callbacks = register_callbacks;
+
+    std::vector<UConverter*>& idle =
+        stri__ucnv_pool[std::make_pair(m_key, m_callbacks)];
+    if (!idle.empty()) {
+        m_ucnv = idle.back();  // already reset by closeConverter
+        idle.pop_back();
+        stri__ucnv_pool_hits += 1;
+        return;
+    }
+
+    stri__ucnv_pool_misses += 1;
+
+    status = U_ZERO_ERROR;
     m_ucnv = ucnv_open(m_name, &status);
     STRI__CHECKICUSTATUS_THROW(status, { m_ucnv = NULL; })
 
@@ -81,6 +122,186 @@ void StriUcnv::openConverter(bool register_callbacks) {
 }
 
 
+/**
+ * Returns the converter (if any) to the pool
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriUcnv::closeConverter() {
+    if (!m_ucnv)
+        return;
+
+    std::vector<UConverter*>& idle =
+        stri__ucnv_pool[std::make_pair(m_key, m_callbacks)];
+    if (idle.size() < STRI__UCNV_POOL_MAX_IDLE) {
+        ucnv_reset(m_ucnv);
+        idle.push_back(m_ucnv);
+    }
+    else
+        ucnv_close(m_ucnv);
+
+    m_ucnv = NULL;
+}
+
+
+/**
+ * Get the converter pool statistics
+ *
+ * @param hits [out] number of converters reused
+ * @param misses [out] number of converters opened
+ * @param idle [out] number of converters currently in the pool
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriUcnv::getPoolStats(double* hits, double* misses, double* idle)
+{
+    *hits = stri__ucnv_pool_hits;
+    *misses = stri__ucnv_pool_misses;
+    *idle = 0.0;
+    for (StriUcnvPoolMap::iterator it = stri__ucnv_pool.begin();
+            it != stri__ucnv_pool.end(); ++it)
+        *idle += (double)it->second.size();
+}
+
+
+/**
+ * Close all the idle converters and reset the statistics
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void StriUcnv::clearPool()
+{
+    for (StriUcnvPoolMap::iterator it = stri__ucnv_pool.begin();
+            it != stri__ucnv_pool.end(); ++it) {
+        for (size_t i=0; i<it->second.size(); ++i)
+            ucnv_close(it->second[i]);
+    }
+    stri__ucnv_pool.clear();
+    stri__ucnv_pool_hits = 0.0;
+    stri__ucnv_pool_misses = 0.0;
+}
+
+
+/* 256-entry byte -> code point tables for single-byte encodings,
+ * keyed by the canonical converter name; see StriUcnv::getSBCSTable.
+ * An empty vector means that an encoding is not eligible.
+ * The tables are never freed (they are small and may be in use).
+ */
+static std::map< std::string, std::vector<UChar32> > stri__ucnv_sbcs_tables;
+
+
+/**
+ * Determine which dedicated conversion kernel (if any) can be used
+ * instead of the ICU converter
+ *
+ * @return one of STRI__UCNV_KERNEL_*
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+int StriUcnv::getKernelType()
+{
+    if (m_kernel >= 0) return m_kernel;
+
+    openConverter(false);
+    UErrorCode status = U_ZERO_ERROR;
+    const char* ucnv_name = ucnv_getName(m_ucnv, &status);
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+    // UTF-16 and UTF-32 (with no byte order given) deal with BOMs, not here
+    if (!strcmp(ucnv_name, "UTF-8"))
+        m_kernel = STRI__UCNV_KERNEL_UTF8;
+    else if (!strcmp(ucnv_name, "UTF-16LE"))
+        m_kernel = STRI__UCNV_KERNEL_UTF16LE;
+    else if (!strcmp(ucnv_name, "UTF-16BE"))
+        m_kernel = STRI__UCNV_KERNEL_UTF16BE;
+    else if (!strcmp(ucnv_name, "UTF-32LE"))
+        m_kernel = STRI__UCNV_KERNEL_UTF32LE;
+    else if (!strcmp(ucnv_name, "UTF-32BE"))
+        m_kernel = STRI__UCNV_KERNEL_UTF32BE;
+    else if (getSBCSTable())
+        m_kernel = STRI__UCNV_KERNEL_SBCS;
+    else
+        m_kernel = STRI__UCNV_KERNEL_NONE;
+
+    return m_kernel;
+}
+
+
+/**
+ * Get the byte -> code point table for a single-byte encoding
+ *
+ * The table is generated (once per encoding) by converting each byte
+ * separately with ICU, so the results are exactly the same as those
+ * obtained with the converter. Bytes that ICU cannot map are marked
+ * with -1; strings including them should be passed to ICU,
+ * which substitutes them and warns.
+ *
+ * Only stateless single-byte encodings that are supersets of ASCII
+ * (e.g., ISO-8859-1, windows-1252) are supported.
+ *
+ * @return 256-element table or NULL if the encoding is not eligible
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+const UChar32* StriUcnv::getSBCSTable()
+{
+    if (m_sbcs_table) return m_sbcs_table;
+
+    openConverter(false);
+
+    std::map< std::string, std::vector<UChar32> >::iterator it =
+        stri__ucnv_sbcs_tables.find(m_key);
+    if (it != stri__ucnv_sbcs_tables.end()) {
+        m_sbcs_table = it->second.empty() ? NULL : it->second.data();
+        return m_sbcs_table;
+    }
+
+    std::vector<UChar32>& table = stri__ucnv_sbcs_tables[m_key];  // empty
+
+    UConverterType type = ucnv_getType(m_ucnv);
+    if (ucnv_getMaxCharSize(m_ucnv) != 1 || !(type == UCNV_SBCS ||
+            type == UCNV_LATIN_1 || type == UCNV_US_ASCII || type == UCNV_MBCS))
+        return NULL;
+
+    // a separate converter, which does not substitute unmapped bytes
+    UErrorCode status = U_ZERO_ERROR;
+    UConverter* ucnv = ucnv_open(m_name, &status);
+    if (U_FAILURE(status)) return NULL;
+    ucnv_setToUCallBack(ucnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &status);
+    if (U_FAILURE(status)) {
+        ucnv_close(ucnv);
+        return NULL;
+    }
+
+    std::vector<UChar32> tmp(256);
+    for (int b=0; b<256; ++b) {
+        char in = (char)b;
+        UChar out[4];
+        status = U_ZERO_ERROR;
+        ucnv_reset(ucnv);
+        int32_t outn = ucnv_toUChars(ucnv, out, 4, &in, 1, &status);
+        tmp[b] = -1;
+        if (U_SUCCESS(status) && outn > 0) {
+            int32_t k = 0;
+            UChar32 c;
+            U16_NEXT(out, k, outn, c);
+            if (k == outn && c >= 0 && !U_IS_SURROGATE(c))
+                tmp[b] = c;
+        }
+
+        if (b <= ASCII_MAXCHARCODE && tmp[b] != b) {
+            ucnv_close(ucnv);
+            return NULL;  // not a superset of ASCII
+        }
+    }
+    ucnv_close(ucnv);
+
+    table.swap(tmp);
+    m_sbcs_table = table.data();
+    return m_sbcs_table;
+}
+
+
 /** Returns a desired converted
  *
  * @return UConverter
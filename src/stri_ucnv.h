@@ -39,6 +39,16 @@
 #include <vector>
 
 
+/* encodings with dedicated conversion kernels, see StriUcnv::getKernelType */
+#define STRI__UCNV_KERNEL_NONE     0
+#define STRI__UCNV_KERNEL_UTF8     1
+#define STRI__UCNV_KERNEL_UTF16LE  2
+#define STRI__UCNV_KERNEL_UTF16BE  3
+#define STRI__UCNV_KERNEL_UTF32LE  4
+#define STRI__UCNV_KERNEL_UTF32BE  5
+#define STRI__UCNV_KERNEL_SBCS     6
+
+
 /**
  * A class to manage an encoding converter
  *
@@ -49,6 +59,9 @@
  *
  * @version 1.7.5.9001 (Marek Gagolewski, 2021-11-27)
  *    #467: R-win-ucrt not marking strings as latin1 #
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    converters are taken from and returned to a process-wide pool
  */
 class StriUcnv  {
 
@@ -58,6 +71,10 @@ private:
     const char* m_name; // encoding, owned by caller
     int m_isutf8;
     int m_is8bit;
+    bool m_callbacks;   // were our callbacks registered (the pool key)?
+    std::string m_key;  // canonical converter name (the pool key)
+    int m_kernel;       // STRI__UCNV_KERNEL_*, -1 if not yet determined
+    const UChar32* m_sbcs_table;
 
     static void STRI__UCNV_FROM_U_CALLBACK_SUBSTITUTE_WARN (
         const void* context,
@@ -77,6 +94,7 @@ private:
         UErrorCode* err);
 
     void openConverter(bool register_callbacks);
+    void closeConverter();
 
 public:
 
@@ -86,13 +104,14 @@ public:
         m_ucnv = NULL; // lazy
         m_isutf8 = NA_LOGICAL;
         m_is8bit = NA_LOGICAL;
+        m_callbacks = false;
+        m_kernel = -1;
+        m_sbcs_table = NULL;
     }
 
     ~StriUcnv()
     {
-        if (m_ucnv)
-            ucnv_close(m_ucnv);
-        m_ucnv = NULL;
+        closeConverter();
     }
 
 
@@ -101,15 +120,21 @@ public:
         m_ucnv = NULL;
         m_isutf8 = NA_LOGICAL;
         m_is8bit = NA_LOGICAL;
+        m_callbacks = false;
+        m_kernel = -1;
+        m_sbcs_table = NULL;
     }
 
 
     StriUcnv& operator=(const StriUcnv& obj) {
-        this->~StriUcnv();
+        closeConverter();
         m_name = obj.m_name;
         m_ucnv = NULL;
         m_isutf8 = NA_LOGICAL;
         m_is8bit = NA_LOGICAL;
+        m_callbacks = false;
+        m_kernel = -1;
+        m_sbcs_table = NULL;
         return *this;
     }
 
@@ -141,9 +166,15 @@ public:
     bool hasASCIIsubset();
     bool is1to1Unicode();
 
+    int getKernelType();
+    const UChar32* getSBCSTable();
+
     static vector<const char*> getStandards();
     static const char* getFriendlyName(const char* canname);
 
+    static void getPoolStats(double* hits, double* misses, double* idle);
+    static void clearPool();
+
 
 //      /** restores default ICU's substitute callbacks
 //       */
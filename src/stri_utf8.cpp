@@ -0,0 +1,594 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include <cstring>
+
+#if !defined(STRI_DISABLE_SIMD) && defined(__GNUC__) && defined(__SSE2__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define STRI__UTF8_SSE2 1
+#include <emmintrin.h>
+#if defined(__clang__) || __GNUC__ >= 5
+#define STRI__UTF8_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define STRI__POPCOUNT(x) __builtin_popcount(x)
+#define STRI__POPCOUNT64(x) __builtin_popcountll(x)
+#else
+static inline int STRI__POPCOUNT64(uint64_t x) {
+    int c = 0;
+    for (; x; x &= x-1) ++c;
+    return c;
+}
+#define STRI__POPCOUNT(x) STRI__POPCOUNT64((uint64_t)(x))
+#endif
+
+
+/* Block-wise scanning of UTF-8 byte sequences: skipping ASCII runs,
+ * counting code points, and validation.
+ *
+ * The kernels below process 8 (SWAR), 16 (SSE2), or 32 (AVX2) bytes at a time.
+ * The best one available on the current CPU is chosen at the first call;
+ * SSE2 is a part of the x86-64 baseline, AVX2 is checked for at run time.
+ * Define STRI_DISABLE_SIMD to use the portable version only.
+ */
+
+
+/** Get the length of the longest prefix consisting of ASCII characters only,
+ *  portable version (8 bytes at a time)
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return index of the first byte > 0x7F or n if there is none
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static R_len_t stri__utf8_ascii_prefix_swar(const char* s, R_len_t n)
+{
+    R_len_t j = 0;
+    for (; j+8 <= n; j += 8) {
+        uint64_t w;
+        memcpy(&w, s+j, 8);  // no aliasing/alignment issues
+        if (w & (uint64_t)0x8080808080808080ULL)
+            break;
+    }
+    while (j < n && (uint8_t)s[j] <= ASCII_MAXCHARCODE)
+        ++j;
+    return j;
+}
+
+
+#ifdef STRI__UTF8_SSE2
+/** Get the length of the longest prefix consisting of ASCII characters only,
+ *  SSE2 version (16 bytes at a time)
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return index of the first byte > 0x7F or n if there is none
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static R_len_t stri__utf8_ascii_prefix_sse2(const char* s, R_len_t n)
+{
+    R_len_t j = 0;
+    for (; j+16 <= n; j += 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s+j)));
+        if (mask)
+            return j+__builtin_ctz((unsigned int)mask);
+    }
+    return j+stri__utf8_ascii_prefix_swar(s+j, n-j);
+}
+#endif
+
+
+#ifdef STRI__UTF8_AVX2
+/** Get the length of the longest prefix consisting of ASCII characters only,
+ *  AVX2 version (32 bytes at a time)
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return index of the first byte > 0x7F or n if there is none
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+__attribute__((target("avx2")))
+static R_len_t stri__utf8_ascii_prefix_avx2(const char* s, R_len_t n)
+{
+    R_len_t j = 0;
+    for (; j+32 <= n; j += 32) {
+        int mask = _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(s+j)));
+        if (mask)
+            return j+__builtin_ctz((unsigned int)mask);
+    }
+    return j+stri__utf8_ascii_prefix_sse2(s+j, n-j);
+}
+#endif
+
+
+/** Count the code points in a valid UTF-8 byte sequence,
+ *  portable version (8 bytes at a time)
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return number of bytes that are not of the form 10xxxxxx
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static R_len_t stri__utf8_count_codepoints_swar(const char* s, R_len_t n)
+{
+    const uint64_t hi = (uint64_t)0x8080808080808080ULL;
+    R_len_t j = 0;
+    R_len_t ncont = 0;  // number of continuation bytes
+    for (; j+8 <= n; j += 8) {
+        uint64_t w;
+        memcpy(&w, s+j, 8);
+        // bit 7 set and bit 6 unset:
+        ncont += (R_len_t)STRI__POPCOUNT64(w & ~(w << 1) & hi);
+    }
+    for (; j < n; ++j)
+        ncont += (R_len_t)U8_IS_TRAIL((uint8_t)s[j]);
+    return n-ncont;
+}
+
+
+#ifdef STRI__UTF8_SSE2
+/** Count the code points in a valid UTF-8 byte sequence,
+ *  SSE2 version (16 bytes at a time)
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return number of bytes that are not of the form 10xxxxxx
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+static R_len_t stri__utf8_count_codepoints_sse2(const char* s, R_len_t n)
+{
+    // as signed chars, continuation bytes are in [-128, -65]
+    const __m128i lim = _mm_set1_epi8((char)0xBF);
+    R_len_t j = 0;
+    R_len_t count = 0;
+    for (; j+16 <= n; j += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s+j));
+        count += STRI__POPCOUNT((unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(v, lim)));
+    }
+    return count+stri__utf8_count_codepoints_swar(s+j, n-j);
+}
+#endif
+
+
+#ifdef STRI__UTF8_AVX2
+/** Count the code points in a valid UTF-8 byte sequence,
+ *  AVX2 version (32 bytes at a time)
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return number of bytes that are not of the form 10xxxxxx
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+__attribute__((target("avx2,popcnt")))
+static R_len_t stri__utf8_count_codepoints_avx2(const char* s, R_len_t n)
+{
+    const __m256i lim = _mm256_set1_epi8((char)0xBF);
+    R_len_t j = 0;
+    R_len_t count = 0;
+    for (; j+32 <= n; j += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(s+j));
+        count += __builtin_popcount((unsigned int)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, lim)));
+    }
+    return count+stri__utf8_count_codepoints_sse2(s+j, n-j);
+}
+#endif
+
+
+typedef R_len_t (*stri__utf8_kernel_t)(const char*, R_len_t);
+
+// portable defaults, replaced by stri__utf8_select_kernels()
+static stri__utf8_kernel_t stri__utf8_ascii_prefix_kernel = stri__utf8_ascii_prefix_swar;
+static stri__utf8_kernel_t stri__utf8_count_codepoints_kernel = stri__utf8_count_codepoints_swar;
+
+
+/** Choose the best kernels for this CPU
+ *
+ * Called once, by R_init_stringi, before any other thread
+ * (see StriParallel) may use the kernels; they are read-only afterwards.
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+void stri__utf8_select_kernels()
+{
+#if defined(STRI__UTF8_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        stri__utf8_count_codepoints_kernel = stri__utf8_count_codepoints_avx2;
+        stri__utf8_ascii_prefix_kernel = stri__utf8_ascii_prefix_avx2;
+        return;
+    }
+#endif
+#if defined(STRI__UTF8_SSE2)
+    stri__utf8_count_codepoints_kernel = stri__utf8_count_codepoints_sse2;
+    stri__utf8_ascii_prefix_kernel = stri__utf8_ascii_prefix_sse2;
+#else
+    stri__utf8_count_codepoints_kernel = stri__utf8_count_codepoints_swar;
+    stri__utf8_ascii_prefix_kernel = stri__utf8_ascii_prefix_swar;
+#endif
+}
+
+
+/** Get the length of the longest prefix of a byte sequence
+ *  that consists of ASCII characters only
+ *
+ * Each ASCII byte is a single code point, so this may be used to skip
+ * over ASCII runs when counting or indexing code points.
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return index of the first byte > 0x7F or n if there is none
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf8_ascii_prefix(const char* s, R_len_t n)
+{
+    // fast exit: the next byte is not ASCII or the string is short
+    if (n <= 0 || (uint8_t)s[0] > ASCII_MAXCHARCODE) return 0;
+    if (n < 8) return stri__utf8_ascii_prefix_swar(s, n);
+
+    return stri__utf8_ascii_prefix_kernel(s, n);
+}
+
+
+/** Count the code points in a valid UTF-8 byte sequence
+ *
+ * The input is not validated: this function merely counts the bytes
+ * that are not continuation bytes, see \code{stri__utf8_invalid_offset}.
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @return number of code points
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf8_count_codepoints(const char* s, R_len_t n)
+{
+    if (n < 16) return stri__utf8_count_codepoints_swar(s, n);
+
+    return stri__utf8_count_codepoints_kernel(s, n);
+}
+
+
+/* Expected lengths of UTF-8 sequences given their first byte;
+ * 0 denotes a byte that cannot start a well-formed sequence
+ * (continuation bytes, overlong 2-byte sequences, > U+10FFFF).
+ */
+static const uint8_t stri__utf8_seq_length[256] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x00
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x10
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x20
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x30
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x40
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x50
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x60
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xA0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xB0
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0xC0
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  // 0xD0
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xE0
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0  // 0xF0
+};
+
+
+/** Find the first ill-formed sequence in a UTF-8 byte sequence
+ *
+ * ASCII runs are skipped block-wise and multibyte sequences are
+ * checked using a lookup table and the ranges of the second bytes
+ * (Table 3-7 in the Unicode Standard). Hence, the result agrees
+ * with what \code{U8_NEXT} reports (overlong forms, surrogates, and
+ * code points > U+10FFFF are ill-formed); NUL bytes are allowed.
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @param nmultibyte [out] if not NULL, the number of multibyte sequences
+ *    (is only meaningful if the sequence is valid)
+ * @return -1 if the sequence is valid UTF-8 or the offset
+ *    of the first byte of the first ill-formed sequence
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf8_invalid_offset(const char* s, R_len_t n, R_len_t* nmultibyte)
+{
+    const uint8_t* b = (const uint8_t*)s;
+    R_len_t nmb = 0;
+    R_len_t j = 0;
+    while (j < n) {
+        j += stri__utf8_ascii_prefix(s+j, n-j);
+        if (j >= n) break;
+
+        // a multibyte sequence starts at j
+        uint8_t len = stri__utf8_seq_length[b[j]];
+        if (len == 0 || j+len > n) return j;
+
+        uint8_t t1 = b[j+1];
+        uint8_t lo = 0x80, hi = 0xBF;
+        switch (b[j]) {
+        case 0xE0: lo = 0xA0; break;  // overlong
+        case 0xED: hi = 0x9F; break;  // surrogates
+        case 0xF0: lo = 0x90; break;  // overlong
+        case 0xF4: hi = 0x8F; break;  // > U+10FFFF
+        }
+        if (t1 < lo || t1 > hi) return j;
+        if (len >= 3 && !U8_IS_TRAIL(b[j+2])) return j;
+        if (len == 4 && !U8_IS_TRAIL(b[j+3])) return j;
+
+        j += len;
+        ++nmb;
+    }
+
+    if (nmultibyte) *nmultibyte = nmb;
+    return -1;
+}
+
+
+/** Decode a valid UTF-8 byte sequence to code points
+ *
+ * ASCII runs are widened without decoding.
+ *
+ * @param s string (must be valid, see \code{stri__utf8_invalid_offset})
+ * @param n number of bytes in s
+ * @param out [out] buffer of at least n code points
+ * @return number of code points written
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf8_decode(const char* s, R_len_t n, UChar32* out)
+{
+    R_len_t i = 0, k = 0;
+    while (i < n) {
+        R_len_t a = i+stri__utf8_ascii_prefix(s+i, n-i);
+        for (; i < a; ++i)
+            out[k++] = (UChar32)(uint8_t)s[i];
+        if (i >= n) break;
+
+        UChar32 c;
+        U8_NEXT_UNSAFE(s, i, c);
+        out[k++] = c;
+    }
+    return k;
+}
+
+
+/* write a 16/32-bit code unit in a given byte order */
+#define STRI__UTF8_PUT16(out, k, u, big_endian) { \
+    if (big_endian) { out[k++] = (char)((u) >> 8); out[k++] = (char)(u); } \
+    else            { out[k++] = (char)(u); out[k++] = (char)((u) >> 8); } }
+
+#define STRI__UTF8_PUT32(out, k, u, big_endian) { \
+    if (big_endian) { out[k++] = (char)((u) >> 24); out[k++] = (char)((u) >> 16); \
+                      out[k++] = (char)((u) >> 8);  out[k++] = (char)(u); } \
+    else            { out[k++] = (char)(u);         out[k++] = (char)((u) >> 8); \
+                      out[k++] = (char)((u) >> 16); out[k++] = (char)((u) >> 24); } }
+
+
+/** Convert a valid UTF-8 byte sequence to UTF-16LE or UTF-16BE
+ *
+ * Gives the same result as ICU's UTF-16LE/BE converters (no BOM is added).
+ *
+ * @param s string (must be valid, see \code{stri__utf8_invalid_offset})
+ * @param n number of bytes in s
+ * @param out [out] buffer of at least 2*n bytes
+ * @param big_endian byte order
+ * @return number of bytes written
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf8_to_utf16(const char* s, R_len_t n, char* out, bool big_endian)
+{
+    R_len_t i = 0, k = 0;
+    while (i < n) {
+        R_len_t a = i+stri__utf8_ascii_prefix(s+i, n-i);
+        for (; i < a; ++i)
+            STRI__UTF8_PUT16(out, k, (uint8_t)s[i], big_endian)
+        if (i >= n) break;
+
+        UChar32 c;
+        U8_NEXT_UNSAFE(s, i, c);
+        if (U_IS_BMP(c))
+            STRI__UTF8_PUT16(out, k, (uint16_t)c, big_endian)
+        else {
+            STRI__UTF8_PUT16(out, k, U16_LEAD(c), big_endian)
+            STRI__UTF8_PUT16(out, k, U16_TRAIL(c), big_endian)
+        }
+    }
+    return k;
+}
+
+
+/** Convert a valid UTF-8 byte sequence to UTF-32LE or UTF-32BE
+ *
+ * Gives the same result as ICU's UTF-32LE/BE converters (no BOM is added).
+ *
+ * @param s string (must be valid, see \code{stri__utf8_invalid_offset})
+ * @param n number of bytes in s
+ * @param out [out] buffer of at least 4*n bytes
+ * @param big_endian byte order
+ * @return number of bytes written
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf8_to_utf32(const char* s, R_len_t n, char* out, bool big_endian)
+{
+    R_len_t i = 0, k = 0;
+    while (i < n) {
+        R_len_t a = i+stri__utf8_ascii_prefix(s+i, n-i);
+        for (; i < a; ++i)
+            STRI__UTF8_PUT32(out, k, (uint32_t)(uint8_t)s[i], big_endian)
+        if (i >= n) break;
+
+        UChar32 c;
+        U8_NEXT_UNSAFE(s, i, c);
+        STRI__UTF8_PUT32(out, k, (uint32_t)c, big_endian)
+    }
+    return k;
+}
+
+
+/** Convert a UTF-16LE or UTF-16BE byte sequence to UTF-8
+ *
+ * Ill-formed input (an odd number of bytes or unpaired surrogates)
+ * is not dealt with here: ICU substitutes and warns in such cases.
+ *
+ * @param s byte sequence
+ * @param n number of bytes in s
+ * @param out [out] buffer of at least 3*(n/2) bytes
+ * @param big_endian byte order
+ * @return number of bytes written or -1 if the input is ill-formed
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf16_to_utf8(const char* s, R_len_t n, char* out, bool big_endian)
+{
+    if (n % 2 != 0) return -1;
+
+    const uint8_t* b = (const uint8_t*)s;
+    int hi = big_endian ? 0 : 1, lo = 1-hi;
+    R_len_t k = 0;
+    for (R_len_t i = 0; i < n; i += 2) {
+        UChar32 c = ((UChar32)b[i+hi] << 8) | b[i+lo];
+        if (c <= ASCII_MAXCHARCODE) {
+            out[k++] = (char)c;
+            continue;
+        }
+
+        if (U16_IS_SURROGATE(c)) {
+            if (!U16_IS_SURROGATE_LEAD(c) || i+3 >= n) return -1;
+            UChar32 c2 = ((UChar32)b[i+2+hi] << 8) | b[i+2+lo];
+            if (!U16_IS_TRAIL(c2)) return -1;
+            c = U16_GET_SUPPLEMENTARY(c, c2);
+            i += 2;
+        }
+        U8_APPEND_UNSAFE(out, k, c);
+    }
+    return k;
+}
+
+
+/** Convert a UTF-32LE or UTF-32BE byte sequence to UTF-8
+ *
+ * Ill-formed input (the number of bytes not divisible by 4, surrogates,
+ * values > U+10FFFF) is not dealt with here: ICU substitutes and warns
+ * in such cases.
+ *
+ * @param s byte sequence
+ * @param n number of bytes in s
+ * @param out [out] buffer of at least n bytes
+ * @param big_endian byte order
+ * @return number of bytes written or -1 if the input is ill-formed
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__utf32_to_utf8(const char* s, R_len_t n, char* out, bool big_endian)
+{
+    if (n % 4 != 0) return -1;
+
+    const uint8_t* b = (const uint8_t*)s;
+    R_len_t k = 0;
+    for (R_len_t i = 0; i < n; i += 4) {
+        uint32_t c = big_endian ?
+            (((uint32_t)b[i] << 24) | ((uint32_t)b[i+1] << 16) | ((uint32_t)b[i+2] << 8) | b[i+3]) :
+            (((uint32_t)b[i+3] << 24) | ((uint32_t)b[i+2] << 16) | ((uint32_t)b[i+1] << 8) | b[i]);
+        if (c <= ASCII_MAXCHARCODE)
+            out[k++] = (char)c;
+        else if (c > 0x10FFFF || U_IS_SURROGATE(c))
+            return -1;
+        else
+            U8_APPEND_UNSAFE(out, k, (UChar32)c);
+    }
+    return k;
+}
+
+
+/** Convert a string in a single-byte encoding to UTF-8
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @param table 256 code points corresponding to each byte, -1 for
+ *    unmapped ones; ASCII bytes must map to themselves,
+ *    see \code{StriUcnv::getSBCSTable}
+ * @param out [out] buffer of at least 4*n bytes
+ * @return number of bytes written or -1 if s contains an unmapped byte
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__sbcs_to_utf8(const char* s, R_len_t n, const UChar32* table, char* out)
+{
+    R_len_t i = 0, k = 0;
+    while (i < n) {
+        R_len_t a = stri__utf8_ascii_prefix(s+i, n-i);
+        memcpy(out+k, s+i, (size_t)a);
+        i += a;
+        k += a;
+        if (i >= n) break;
+
+        UChar32 c = table[(uint8_t)s[i++]];
+        if (c < 0) return -1;
+        U8_APPEND_UNSAFE(out, k, c);
+    }
+    return k;
+}
+
+
+/** Convert a string in a single-byte encoding to UTF-16
+ *
+ * @param s string
+ * @param n number of bytes in s
+ * @param table see \code{stri__sbcs_to_utf8}
+ * @param out [out] buffer of at least n code units
+ * @return n or -1 if s contains an unmapped byte or a byte mapped
+ *    to a supplementary code point
+ *
+ * @version 1.8.8 (2026-10-19)
+ */
+R_len_t stri__sbcs_to_utf16(const char* s, R_len_t n, const UChar32* table, UChar* out)
+{
+    for (R_len_t i = 0; i < n; ++i) {
+        UChar32 c = table[(uint8_t)s[i]];
+        if (c < 0 || !U_IS_BMP(c)) return -1;
+        out[i] = (UChar)c;
+    }
+    return n;
+}
@@ -32,6 +32,7 @@
 
 #include "stri_stringi.h"
 #include "stri_container_utf8_indexable.h"
+#include "stri_brkiter.h"
 #include <deque>
 #include <vector>
 #include <utility>
@@ -241,6 +242,10 @@ struct StriWrapLineStart {
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-06-09)
  *    BIGSKIP: no more CHARSXP on out on "" input
+ *
+ * @version 1.8.8 (2026-10-19)
+ *    use stri__brkiter_create (cached prototypes);
+ *    ASCII strings: use stri__brkiter_ascii_boundaries if possible
  */
 SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
                SEXP indent, SEXP exdent, SEXP prefix, SEXP initial, SEXP whitespace_only,
@@ -261,7 +266,6 @@ SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
 
 
     const char* qloc = stri__prepare_arg_locale(locale, "locale"); /* this is R_alloc'ed */
-    Locale loc = Locale::createFromName(qloc);
     PROTECT(str     = stri__prepare_arg_string(str, "str"));
     PROTECT(prefix  = stri__prepare_arg_string_1(prefix, "prefix"));
     PROTECT(initial = stri__prepare_arg_string_1(initial, "initial"));
@@ -271,16 +275,12 @@ SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
 
     STRI__ERROR_HANDLER_BEGIN(3)
     UErrorCode status = U_ZERO_ERROR;
-    briter = BreakIterator::createLineInstance(loc, status);
-    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-    // NOTE: this is very invasive for there are very few dedicated brkiters!
-    if (status == U_USING_DEFAULT_WARNING && qloc) {
-        UErrorCode status2 = U_ZERO_ERROR;
-        const char* valid_locale = briter->getLocaleID(ULOC_VALID_LOCALE, status2);
-        if (valid_locale && !strcmp(valid_locale, "root"))
-            Rf_warning("%s", ICUError::getICUerrorName(status));
-    }
+    // NOTE: this warns if there is no dedicated brkiter for qloc, which is
+    // very invasive for there are very few dedicated brkiters!
+    briter = stri__brkiter_create(UBRK_LINE, qloc, UnicodeString());
+    bool ascii_supported = stri__brkiter_ascii_supported(UBRK_LINE, briter);
+    std::vector<R_len_t> ascii_bdr;
+    std::vector<int32_t> ascii_status;
 
     R_len_t str_length = LENGTH(str);
     StriContainerUTF8_indexable str_cont(str, str_length);
@@ -321,16 +321,21 @@ SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
         status = U_ZERO_ERROR;
         const char* str_cur_s = str_cont.get(i).c_str();
         R_len_t str_cur_n = str_cont.get(i).length();
-        str_text = utext_openUTF8(str_text, str_cur_s, str_cont.get(i).length(), &status);
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-        status = U_ZERO_ERROR;
-        briter->setText(str_text, status);
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        bool ascii_used = ascii_supported && stri__brkiter_ascii_boundaries(
+            UBRK_LINE, str_cur_s, str_cur_n, ascii_bdr, ascii_status);
+        size_t ascii_idx = 0;
+        if (!ascii_used) {
+            str_text = utext_openUTF8(str_text, str_cur_s, str_cont.get(i).length(), &status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+            status = U_ZERO_ERROR;
+            briter->setText(str_text, status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        }
 
         // first generate a list of positions of line breaks
         deque< R_len_t > occurrences_list; // this could be an R_len_t queue
-        R_len_t match = briter->first();
+        R_len_t match = (ascii_used)?ascii_bdr[ascii_idx++]:briter->first();
         while (match != BreakIterator::DONE) {
 
             if (!whitespace_only_val)
@@ -346,7 +351,10 @@ SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
                     occurrences_list.push_back(match);
             }
 
-            match = briter->next();
+            if (ascii_used)
+                match = (ascii_idx < ascii_bdr.size())?ascii_bdr[ascii_idx++]:BreakIterator::DONE;
+            else
+                match = briter->next();
         }
 
         R_len_t noccurrences = (R_len_t)occurrences_list.size(); // number of boundaries